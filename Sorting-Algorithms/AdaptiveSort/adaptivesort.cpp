@@ -0,0 +1,1219 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> ADAPTIVESORT - SAMPLING SORT DISPATCHER <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This adaptivesort.cpp file is a personal reference of an adaptive sort front-end. Every other program in this repository sorts with the
+one algorithm it was named after, so picking the best one for an input means running each program by hand. No single algorithm wins on
+every input: InsertionSort is the fastest on tiny & almost sorted arrays, MergeSort is the only stable one, CountingSort needs one pass
+when the values lie in a narrow range, three-way QuickSort collapses runs of a few values spread far apart, and RadixSort does not
+compare at all on large integers spread over a wide range. adaptiveSort() profiles the input cheaply, routes
+it to the engine that suits it best, and logs its decision (and the measurements behind it) so the thresholds can be tuned. The engines
+are compact copies of the ones in the neighbouring directories, so this program stands on its own.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Input Profile: profileInput() measures the input in one streaming pass plus one small sample:
+        Size - (n), the number of elements
+        Descents & Ascents - The number of adjacent pairs [i] > [i + 1] and [i] < [i + 1], counted without branching over the whole
+                             array. (descents + 1) is the number of ascending runs, so 0 descents means the array is already sorted,
+                             and (n - 1) descents means it is strictly descending
+        Range - The minimum & maximum, found in the same pass, and the range k = max - min + 1 (computed in 64-bit arithmetic)
+        Distinct Sample - Up to 256 evenly spaced elements are copied & sorted, and their distinct values are counted. Few distinct
+                          values in the sample means few unique values (many duplicates) in the whole array
+        The profile costs one O(n) pass plus O(1) for the sample.
+
+>> Routing Rules: adaptiveSort() applies the first rule that matches, and logs the profile and the rule:
+        (1) n <= TINY_SIZE (24)                            -> insertion (no setup cost, the fastest on tiny arrays)
+        (2) 0 descents                                     -> none (already sorted)
+        (3) n - 1 descents                                 -> reverse (strictly descending, reversing keeps it stable)
+        (4) descents <= n / NEARLY_SORTED_DIVISOR (32)     -> insertion, bounded: it gives up after (INSERTION_MOVE_LIMIT * n) moves
+                                                              (a few far-away elements can hide many inversions behind few descents)
+                                                              and the remaining rules are applied to the partly sorted array
+        (5) stable=1 requested                             -> merge (the only stable engine besides insertion)
+        (6) k <= n / NARROW_RANGE_DIVISOR (2)              -> counting (narrow range: one histogram pass & one rewrite pass)
+        (7) <= FEW_UNIQUE_MAX (6) distinct sampled values  -> threeway (few values spread over a wide range: each value is finished
+                                                              in one partition, while radix still needs a pass per varying digit)
+        (8) n >= RADIX_MIN_SIZE (2048) & k > n / 2         -> radix (wide range: at most 4 linear passes beat n*log(n) compares)
+        (9) otherwise                                      -> quick (IntroSort)
+        The thresholds of rules (6) & (7) come from the benchmark (./a.out bench, fewunique & fewwide inputs): CountingSort beats
+        radix up to k ~ n, and three-way QuickSort beats radix on wide ranges up to ~8 unique values, at every size from 5000 to
+        1000000 integers. Both are kept below the crossover.
+
+>> Engines: The routed engines are compact copies of the engines in the neighbouring directories:
+        insertion - InsertionSort (InsertionSort/insertionsort.cpp), and a bounded variant that stops after a budget of moves
+        merge - Top-down MergeSort with a scratch buffer allocated once, InsertionSort leaves of 16 elements, and merges skipped when
+                the two halves are already in order (MergeSort/mergesort.cpp)
+        threeway - Dijkstra's three-way QuickSort: the sub-array is split into less than, equal to & greater than the pivot, and only
+                   the outer parts are sorted further (partitionThreeWay() of QuickSort-Lomuto's/quicksort.cpp)
+        quick - IntroSort with Hoare's partitioning and a median of 3 pivot, HeapSort after (2 * log2(n)) levels
+                (QuickSort-Hoare's/quicksort.cpp)
+        radix - LSD RadixSort on 8-bit digits, skipping the passes where every element has the same digit (RadixSort-LSD)
+        counting - CountingSort over the range [min, max] (CountingSort/countingsort.cpp); forced by hand on a range of more than
+                   2^28 values, it sorts with radix instead
+        Both QuickSort engines fall back to HeapSort, so no routing decision can cost more than O(n*log(n)).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Stability: Only the insertion, reverse (strictly descending input) & merge routes are stable, so stable=1 restricts adaptiveSort() to
+              them. Integers that compare equal are indistinguishable, so the flag only changes the route (and the time) here, not the
+              output. It matters once the engines sort records by key.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        Profile: O(n) - One pass over the array, plus sorting a sample of at most 256 elements: O(1)
+        Dispatch: The complexity of the routed engine:
+                    insertion - O(n + inversions), at most O(n) moves when bounded (INSERTION_MOVE_LIMIT * n)
+                    merge, quick - O(n*log(n)) in all cases
+                    threeway - O(n*log(u)), u = # of unique values (O(n*log(n)) worst-case through HeapSort)
+                    radix - O(w*n), w = # of 8-bit digits that vary (at most 4)
+                    counting - O(n + k), k = max - min + 1 (at most n / 2 when routed)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        Profile: O(1) - A fixed sample of 256 integers
+        Dispatch: insertion, threeway & quick - O(log(n)) (recursion on the smaller side)
+                  merge & radix - O(n) (one scratch buffer of n integers)
+                  counting - O(k) (one counter per possible value)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example AdaptiveSort Execution:
+        data3.txt - 63 integers from 0 to 3, unsorted
+            (1) Profile: n = 63, descents = 6, range = 0 -> 3 (k = 4), distinct sample = 4 / 63
+            (2) Rule (4): 6 descents <= 63 / 32 = 1? No
+            (3) Rule (6): k = 4 <= 63 / 2 = 31? Yes -> counting
+        1000000 random integers from -10^6 to 10^6: k = 2000001 > 500000, 256 / 256 distinct -> Rule (8) -> radix
+        1000000 integers from 0 to 3: k = 4 -> Rule (6) -> counting
+        1000000 integers, 4 values spread over every int: k ~ 2^32, 4 / 256 distinct -> Rule (7) -> threeway
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ adaptivesort.cpp || g++ adaptivesort.cpp -g -o adaptivesort
+        ./a.out || valgrind ./a.out || valgrind ./adaptivesort || valgrind --leak-check=full ./adaptivesort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = auto (default, adaptive dispatcher) | insertion | merge | threeway | quick | radix | counting | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 1000000)
+            options = stable=0 (1 = only route to stable engines)
+                      log=1 (0 = do not print the routing decision)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <cstring>   // memcpy
+#include <climits>   // INT_MAX, INT_MIN
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort, reverse, min_element, max_element
+
+using namespace std;
+
+const int TINY_SIZE = 24;                // Rule (1): Largest array sorted with insertionSort() without looking any further
+const int NEARLY_SORTED_DIVISOR = 32;    // Rule (4): At most (n / 32) descents -> Bounded insertionSort()
+const int INSERTION_MOVE_LIMIT = 8;      // Rule (4): The bounded insertionSort() gives up after (8 * n) element moves
+const int NARROW_RANGE_DIVISOR = 2;      // Rule (6): Range k <= n / 2 -> CountingSort (measured crossover with radix near k = n)
+const int FEW_UNIQUE_MAX = 6;            // Rule (7): At most 6 distinct sampled values -> Three-way QuickSort (crossover near 8)
+const int RADIX_MIN_SIZE = 2048;         // Rule (8): Smallest array sorted with RadixSort (measured crossover with quick)
+const int PROFILE_SAMPLE_SIZE = 256;     // Elements sampled by profileInput() to estimate the # of distinct values
+const int INSERTION_CUTOFF = 16;         // Sub-arrays of 16 or fewer elements are finished with insertionSort() by every engine
+const int RADIX_DIGIT_BITS = 8;          // Bits per RadixSort digit
+const int RADIX = 1 << RADIX_DIGIT_BITS; // # of buckets per RadixSort digit
+
+const long long MAX_COUNTING_RANGE = 1LL << 28; // Largest range (k) the counting engine sorts by hand (1 GB of counters)
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSort() function sorts the sub-array bounded by [low] & [high] in place, like InsertionSort/insertionsort.cpp.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSort(int dataArray[], int low, int high)
+{
+    for (int i = low + 1; i <= high; i++)
+    {
+        int element = dataArray[i]; // Get the element stored at current index
+        int index = i;              // Set index = to the index of the selected element
+
+        while ((index > low) && (dataArray[index - 1] > element)) // Shift every greater element one position to the right
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element; // Insert the element at its correct position within the sorted sub-array
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSortBounded() function runs insertionSort() on the whole array, but gives up once it has moved more than (moveLimit)
+elements. The array is then a permutation of the input with a sorted prefix, so any other engine can still sort it.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            long long moveLimit - Largest # of element moves (shifts) allowed
+    >> Return:
+            bool - True if the array was sorted, false if the budget ran out first
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool insertionSortBounded(int dataArray[], int arraySize, long long moveLimit)
+{
+    long long moves = 0; // Element shifts so far
+
+    for (int i = 1; i < arraySize; i++)
+    {
+        int element = dataArray[i];
+        int index = i;
+
+        while ((index > 0) && (dataArray[index - 1] > element))
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element;
+        moves += i - index;
+
+        if (moves > moveLimit)
+        {
+            return false; // Too many inversions for InsertionSort -> The caller picks another engine
+        }
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The merge() function merges the sorted sub-arrays [left] -> [middle] & [middle + 1] -> [right]. The left sub-array is copied to the
+scratch buffer, and merged back into the array from the left. Ties are taken from the left sub-array, which keeps the merge stable.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Index of the first element of the left sub-array
+            int middle - Index of the last element of the left sub-array
+            int right - Index of the last element of the right sub-array
+            int scratch[] - Buffer of at least (middle - left + 1) integers
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void merge(int dataArray[], int left, int middle, int right, int scratch[])
+{
+    int leftSize = middle - left + 1;
+    memcpy(scratch, dataArray + left, leftSize * sizeof(int));
+
+    int i = 0;          // Next element of the left sub-array (in scratch)
+    int j = middle + 1; // Next element of the right sub-array
+    int k = left;       // Next output position
+
+    while (i < leftSize && j <= right)
+    {
+        dataArray[k++] = (dataArray[j] < scratch[i]) ? dataArray[j++] : scratch[i++]; // Ties from the left -> Stable
+    }
+
+    while (i < leftSize) // The rest of the right sub-array is already in place
+    {
+        dataArray[k++] = scratch[i++];
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSort() function sorts the sub-array bounded by [left] & [right] with top-down MergeSort. Sub-arrays of INSERTION_CUTOFF or
+fewer elements are sorted with insertionSort(), and two halves that are already in order ([middle] <= [middle + 1]) are not merged.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Index of the first element in sub-array to be sorted
+            int right - Index of the last element in sub-array to be sorted
+            int scratch[] - Buffer of at least ((right - left) / 2 + 1) integers
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeSort(int dataArray[], int left, int right, int scratch[])
+{
+    if ((right - left) + 1 <= INSERTION_CUTOFF)
+    {
+        insertionSort(dataArray, left, right);
+        return;
+    }
+
+    int middle = left + (right - left) / 2;
+    mergeSort(dataArray, left, middle, scratch);
+    mergeSort(dataArray, middle + 1, right, scratch);
+
+    if (dataArray[middle] > dataArray[middle + 1]) // Halves overlap -> Merge them
+    {
+        merge(dataArray, left, middle, right, scratch);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The siftDown() function restores the max-heap property of the heap stored in dataArray[low] -> dataArray[low + heapSize - 1], by moving
+the element at heap position (root) down until both of its children are smaller or equal (QuickSort-Hoare's/quicksort.cpp).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element of the heap
+            int root - Heap position of the element to be moved down
+            int heapSize - Number of elements in the heap
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void siftDown(int dataArray[], int low, int root, int heapSize)
+{
+    int element = dataArray[low + root]; // Element being moved down
+
+    while ((2 * root) + 1 < heapSize)
+    {
+        int child = (2 * root) + 1; // Left child
+
+        if (child + 1 < heapSize && dataArray[low + child] < dataArray[low + child + 1])
+        {
+            child++; // The right child is larger
+        }
+
+        if (dataArray[low + child] <= element)
+        {
+            break; // Both children are smaller or equal -> Heap property restored
+        }
+
+        dataArray[low + root] = dataArray[low + child]; // Move the larger child up
+        root = child;
+    }
+
+    dataArray[low + root] = element;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The heapSort() function sorts the sub-array bounded by [low] & [high] in place in O(n*log(n)) time. It is the fallback of both QuickSort
+engines once their recursion gets too deep.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void heapSort(int dataArray[], int low, int high)
+{
+    int heapSize = (high - low) + 1;
+
+    for (int root = (heapSize / 2) - 1; root >= 0; root--) // Build the max-heap bottom-up
+    {
+        siftDown(dataArray, low, root, heapSize);
+    }
+
+    for (int last = heapSize - 1; last > 0; last--)
+    {
+        int temp = dataArray[low];              // Largest remaining element (root)
+        dataArray[low] = dataArray[low + last]; // Move the last heap element to the root
+        dataArray[low + last] = temp;           // The largest element is now in its sorted position
+        siftDown(dataArray, low, 0, last);      // Restore the heap on the remaining (last) elements
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The depthLimit() function returns the # of partitioning levels the QuickSort engines may use before falling back to heapSort().
+    >> Parameters:
+            int arraySize - Size of the array
+    >> Return:
+            int - 2 * floor(log2(n))
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int depthLimit(int arraySize)
+{
+    int limit = 0;
+    for (int size = arraySize; size > 1; size /= 2)
+    {
+        limit += 2;
+    }
+
+    return limit;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The medianOf3() function returns the median of the first, middle & last elements of the sub-array bounded by [low] & [high].
+    >> Parameters:
+            const int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+    >> Return:
+            int - The median value (an element of the sub-array)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int medianOf3(const int dataArray[], int low, int high)
+{
+    int first = dataArray[low];
+    int middle = dataArray[low + (high - low) / 2];
+    int last = dataArray[high];
+
+    if (first > middle)
+    {
+        swap(first, middle);
+    }
+    if (middle > last)
+    {
+        middle = last;
+    }
+
+    return (first > middle) ? first : middle;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionFunction() function partitions the sub-array bounded by [low] & [high] with Hoare's scheme around the median of 3, and
+returns the boundary [j]: every element of [low] -> [j] is less than or equal to every element of [j + 1] -> [high]. The median is an
+element of the first or middle position, or is not larger than one of them, so both sides are non-empty.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be partitioned (at least 3 elements)
+            int high - Index of the last element in sub-array to be partitioned
+    >> Return:
+            int - Index of the last element of the left partition
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int partitionFunction(int dataArray[], int low, int high)
+{
+    int pivot = medianOf3(dataArray, low, high);
+    int i = low - 1;
+    int j = high + 1;
+
+    while (true)
+    {
+        do
+        {
+            i++;
+        } while (dataArray[i] < pivot);
+
+        do
+        {
+            j--;
+        } while (dataArray[j] > pivot);
+
+        if (i >= j)
+        {
+            return j;
+        }
+
+        swap(dataArray[i], dataArray[j]);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSort() function sorts the sub-array bounded by [low] & [high] with IntroSort: Hoare's partitions until (depth) levels have been
+used, heapSort() below that, and insertionSort() on partitions of INSERTION_CUTOFF or fewer elements. The smaller side is sorted
+recursively and the larger side by looping, so the recursion depth stays below log2(n).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int depth - Number of partitioning levels left before falling back to heapSort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSort(int dataArray[], int low, int high, int depth)
+{
+    while ((high - low) + 1 > INSERTION_CUTOFF)
+    {
+        if (depth-- == 0)
+        {
+            heapSort(dataArray, low, high);
+            return;
+        }
+
+        int boundary = partitionFunction(dataArray, low, high);
+
+        if (boundary - low < high - boundary) // Recurse on the smaller side, loop on the larger one
+        {
+            quickSort(dataArray, low, boundary, depth);
+            low = boundary + 1;
+        }
+        else
+        {
+            quickSort(dataArray, boundary + 1, high, depth);
+            high = boundary;
+        }
+    }
+
+    insertionSort(dataArray, low, high);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSort3Way() function sorts the sub-array bounded by [low] & [high] with Dijkstra's three-way partitioning around the median of 3:
+one pass splits it into [low] -> [lt - 1] (less than the pivot), [lt] -> [gt] (equal to the pivot, already in place) & [gt + 1] ->
+[high] (greater than the pivot). Only the outer parts are sorted further, so every value is a pivot at most once and an input of (u)
+unique values needs O(log(u)) levels. Like quickSort(), it falls back to heapSort() after (depth) levels.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int depth - Number of partitioning levels left before falling back to heapSort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSort3Way(int dataArray[], int low, int high, int depth)
+{
+    while ((high - low) + 1 > INSERTION_CUTOFF)
+    {
+        if (depth-- == 0)
+        {
+            heapSort(dataArray, low, high);
+            return;
+        }
+
+        int pivot = medianOf3(dataArray, low, high);
+        int lt = low;  // First element equal to the pivot
+        int gt = high; // Last element equal to the pivot
+        int i = low;   // Next element to classify
+
+        while (i <= gt)
+        {
+            if (dataArray[i] < pivot)
+            {
+                swap(dataArray[lt++], dataArray[i++]);
+            }
+            else if (dataArray[i] > pivot)
+            {
+                swap(dataArray[i], dataArray[gt--]);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (lt - low < high - gt) // Recurse on the smaller outer part, loop on the larger one
+        {
+            quickSort3Way(dataArray, low, lt - 1, depth);
+            low = gt + 1;
+        }
+        else
+        {
+            quickSort3Way(dataArray, gt + 1, high, depth);
+            high = lt - 1;
+        }
+    }
+
+    insertionSort(dataArray, low, high);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The radixDigit() function returns the 8-bit digit of an integer at the given shift, with the sign bit flipped so that negative integers
+sort before positive ones.
+    >> Parameters:
+            int element - Integer to take the digit of
+            int shift - Position of the digit's lowest bit
+    >> Return:
+            unsigned - Digit in [0, RADIX - 1]
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+inline unsigned radixDigit(int element, int shift)
+{
+    return (((unsigned)element ^ 0x80000000u) >> shift) & (RADIX - 1);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The radixSort() function sorts the array with LSD RadixSort (RadixSort-LSD/radixsort.cpp without the write-combining scatter). One pass
+builds the histograms of all 4 digits, every digit whose elements all fall into one bucket is skipped, and the other digits are
+scattered back & forth between the array and a scratch buffer.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void radixSort(int dataArray[], int arraySize)
+{
+    const int digits = 32 / RADIX_DIGIT_BITS;
+    vector<int> counts(digits * RADIX, 0); // counts[digit * RADIX + bucket]
+    vector<int> buffer(arraySize);
+
+    for (int i = 0; i < arraySize; i++) // Histograms of every digit in one pass
+    {
+        for (int digit = 0; digit < digits; digit++)
+        {
+            counts[digit * RADIX + radixDigit(dataArray[i], digit * RADIX_DIGIT_BITS)]++;
+        }
+    }
+
+    int *source = dataArray;
+    int *destination = buffer.data();
+
+    for (int digit = 0; digit < digits; digit++)
+    {
+        int *count = counts.data() + digit * RADIX;
+        int shift = digit * RADIX_DIGIT_BITS;
+
+        if (count[radixDigit(source[0], shift)] == arraySize)
+        {
+            continue; // Every element has the same digit -> The pass would not move anything
+        }
+
+        int offset = 0;
+        for (int bucket = 0; bucket < RADIX; bucket++) // Counts -> Starting offsets
+        {
+            int size = count[bucket];
+            count[bucket] = offset;
+            offset += size;
+        }
+
+        for (int i = 0; i < arraySize; i++)
+        {
+            destination[count[radixDigit(source[i], shift)]++] = source[i];
+        }
+
+        swap(source, destination);
+    }
+
+    if (source != dataArray) // Odd # of passes -> The result is in the buffer
+    {
+        memcpy(dataArray, source, arraySize * sizeof(int));
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The countingSort() function sorts the array, whose elements all lie in [minimum, maximum], by counting every value & rewriting the
+array from the counts (CountingSort/countingsort.cpp without the histogram output).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int minimum - Smallest element of the array
+            int maximum - Largest element of the array
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void countingSort(int dataArray[], int arraySize, int minimum, int maximum)
+{
+    size_t range = (size_t)((long long)maximum - (long long)minimum + 1); // k = # of possible values
+    vector<int> counts(range, 0);
+
+    for (int i = 0; i < arraySize; i++) // Histogram pass
+    {
+        counts[(size_t)((long long)dataArray[i] - minimum)]++;
+    }
+
+    int index = 0;
+    for (size_t value = 0; value < range; value++) // Rewrite pass
+    {
+        int element = (int)((long long)minimum + (long long)value);
+        for (int count = counts[value]; count > 0; count--)
+        {
+            dataArray[index++] = element;
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The InputProfile struct holds the measurements profileInput() takes of an array.
+    >> Members:
+            int size - # of elements
+            int descents - # of adjacent pairs with [i] > [i + 1]
+            int ascents - # of adjacent pairs with [i] < [i + 1]
+            int minimum - Smallest element
+            int maximum - Largest element
+            long long range - # of possible values, k = maximum - minimum + 1
+            int sampleSize - # of sampled elements
+            int sampleDistinct - # of distinct values among the sampled elements
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct InputProfile
+{
+    int size = 0;
+    int descents = 0;
+    int ascents = 0;
+    int minimum = 0;
+    int maximum = 0;
+    long long range = 0;
+    int sampleSize = 0;
+    int sampleDistinct = 0;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The profileInput() function measures the array for adaptiveSort(): one branchless pass counts the descents & ascents and finds the
+range, and up to PROFILE_SAMPLE_SIZE evenly spaced elements are sorted to count their distinct values.
+    >> Parameters:
+            const int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array (at least 1)
+    >> Return:
+            InputProfile - The measurements
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+InputProfile profileInput(const int dataArray[], int arraySize)
+{
+    InputProfile profile;
+    profile.size = arraySize;
+    profile.minimum = dataArray[0];
+    profile.maximum = dataArray[0];
+
+    for (int i = 1; i < arraySize; i++)
+    {
+        profile.descents += (dataArray[i - 1] > dataArray[i]);
+        profile.ascents += (dataArray[i - 1] < dataArray[i]);
+        profile.minimum = (dataArray[i] < profile.minimum) ? dataArray[i] : profile.minimum;
+        profile.maximum = (dataArray[i] > profile.maximum) ? dataArray[i] : profile.maximum;
+    }
+    profile.range = (long long)profile.maximum - (long long)profile.minimum + 1;
+
+    profile.sampleSize = (arraySize < PROFILE_SAMPLE_SIZE) ? arraySize : PROFILE_SAMPLE_SIZE;
+    int sample[PROFILE_SAMPLE_SIZE];
+    for (int i = 0; i < profile.sampleSize; i++)
+    {
+        sample[i] = dataArray[(int)((long long)i * arraySize / profile.sampleSize)]; // Evenly spaced
+    }
+
+    insertionSort(sample, 0, profile.sampleSize - 1);
+    profile.sampleDistinct = 1;
+    for (int i = 1; i < profile.sampleSize; i++)
+    {
+        profile.sampleDistinct += (sample[i - 1] != sample[i]);
+    }
+
+    return profile;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The SortDecision struct records the routing decision of adaptiveSort(), so that it can be logged and compared between inputs.
+    >> Members:
+            InputProfile profile - Measurements the decision was based on
+            string engine - Engine that sorted the array (insertion | none | reverse | merge | counting | threeway | radix | quick)
+            string reason - Routing rule that picked the engine
+            bool insertionGaveUp - True if rule (4) tried the bounded insertionSort() and ran out of moves
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct SortDecision
+{
+    InputProfile profile;
+    string engine;
+    string reason;
+    bool insertionGaveUp = false;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The logDecision() function prints a routing decision on one line: the profile, the engine & the rule that picked it.
+    >> Parameters:
+            ostream &log - Stream to print to
+            const SortDecision &decision - Decision to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void logDecision(ostream &log, const SortDecision &decision)
+{
+    const InputProfile &profile = decision.profile;
+
+    log << "adaptiveSort: n=" << profile.size << " descents=" << profile.descents << " ascents=" << profile.ascents << " range="
+        << profile.minimum << ".." << profile.maximum << " (k=" << profile.range << ") distinct=" << profile.sampleDistinct << "/"
+        << profile.sampleSize << " -> " << decision.engine << " (" << decision.reason
+        << ((decision.insertionGaveUp) ? ", bounded insertion gave up" : "") << ")" << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The adaptiveSort() function profiles the array with profileInput(), and sorts it with the engine picked by the first routing rule that
+matches (see Routing Rules above). The decision is returned, and printed to (log) unless it is nullptr.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            bool stable - True to only route to stable engines
+            ostream *log - Stream to print the decision to, nullptr = do not print
+    >> Return:
+            SortDecision - The profile, the engine & the rule
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+SortDecision adaptiveSort(int dataArray[], int arraySize, bool stable = false, ostream *log = nullptr)
+{
+    SortDecision decision;
+
+    if (arraySize <= 0)
+    {
+        decision.engine = "none";
+        decision.reason = "empty";
+        return decision;
+    }
+
+    InputProfile &profile = decision.profile;
+    profile = profileInput(dataArray, arraySize);
+
+    if (arraySize <= TINY_SIZE)
+    {
+        decision.engine = "insertion";
+        decision.reason = "rule 1: tiny";
+        insertionSort(dataArray, 0, arraySize - 1);
+    }
+    else if (profile.descents == 0)
+    {
+        decision.engine = "none";
+        decision.reason = "rule 2: already sorted";
+    }
+    else if (profile.descents == arraySize - 1)
+    {
+        decision.engine = "reverse";
+        decision.reason = "rule 3: strictly descending";
+        reverse(dataArray, dataArray + arraySize);
+    }
+    else if (profile.descents <= arraySize / NEARLY_SORTED_DIVISOR &&
+             insertionSortBounded(dataArray, arraySize, (long long)INSERTION_MOVE_LIMIT * arraySize))
+    {
+        decision.engine = "insertion";
+        decision.reason = "rule 4: nearly sorted";
+    }
+    else
+    {
+        decision.insertionGaveUp = (profile.descents <= arraySize / NEARLY_SORTED_DIVISOR); // Rule (4) was tried above
+
+        if (stable)
+        {
+            decision.engine = "merge";
+            decision.reason = "rule 5: stable requested";
+            vector<int> scratch(arraySize / 2 + 1);
+            mergeSort(dataArray, 0, arraySize - 1, scratch.data());
+        }
+        else if (profile.range <= arraySize / NARROW_RANGE_DIVISOR)
+        {
+            decision.engine = "counting";
+            decision.reason = "rule 6: narrow range";
+            countingSort(dataArray, arraySize, profile.minimum, profile.maximum);
+        }
+        else if (profile.sampleDistinct <= FEW_UNIQUE_MAX)
+        {
+            decision.engine = "threeway";
+            decision.reason = "rule 7: few unique values over a wide range";
+            quickSort3Way(dataArray, 0, arraySize - 1, depthLimit(arraySize));
+        }
+        else if (arraySize >= RADIX_MIN_SIZE && profile.range > arraySize / NARROW_RANGE_DIVISOR)
+        {
+            decision.engine = "radix";
+            decision.reason = "rule 8: large over a wide range";
+            radixSort(dataArray, arraySize);
+        }
+        else
+        {
+            decision.engine = "quick";
+            decision.reason = "rule 9: default";
+            quickSort(dataArray, 0, arraySize - 1, depthLimit(arraySize));
+        }
+    }
+
+    if (log != nullptr)
+    {
+        logDecision(*log, decision);
+    }
+
+    return decision;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the tuning knobs of the sorting engines, which can be set on the command line as option=value.
+    >> Members:
+            int stable - 1 to only let adaptiveSort() route to stable engines
+            int log - 1 to print the routing decision of adaptiveSort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    int stable = 0;
+    int log = 1;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the array with the named engine: the adaptive dispatcher, or one of its engines forced by hand.
+    >> Parameters:
+            const string &engine - auto | insertion | merge | threeway | quick | radix | counting
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            const EngineOptions &options - Tuning knobs of the engines
+            ostream *log - Stream the auto engine prints its decision to, nullptr = do not print
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize, const EngineOptions &options, ostream *log = nullptr)
+{
+    if (engine == "auto")
+    {
+        adaptiveSort(dataArray, arraySize, options.stable != 0, log);
+    }
+    else if (engine == "insertion")
+    {
+        insertionSort(dataArray, 0, arraySize - 1);
+    }
+    else if (engine == "merge")
+    {
+        vector<int> scratch(arraySize / 2 + 1);
+        mergeSort(dataArray, 0, arraySize - 1, scratch.data());
+    }
+    else if (engine == "threeway")
+    {
+        quickSort3Way(dataArray, 0, arraySize - 1, depthLimit(arraySize));
+    }
+    else if (engine == "quick")
+    {
+        quickSort(dataArray, 0, arraySize - 1, depthLimit(arraySize));
+    }
+    else if (engine == "radix")
+    {
+        if (arraySize > 0)
+        {
+            radixSort(dataArray, arraySize);
+        }
+    }
+    else if (engine == "counting")
+    {
+        if (arraySize > 0)
+        {
+            int minimum = *min_element(dataArray, dataArray + arraySize);
+            int maximum = *max_element(dataArray, dataArray + arraySize);
+            if ((long long)maximum - minimum + 1 <= MAX_COUNTING_RANGE)
+            {
+                countingSort(dataArray, arraySize, minimum, maximum);
+            }
+            else // Too many counters -> The wide-range engine instead
+            {
+                radixSort(dataArray, arraySize);
+            }
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Tuning knobs of the engines to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    int value = atoi(argument.c_str() + separator + 1);
+
+    if (name == "stable")
+    {
+        options.stable = value;
+    }
+    else if (name == "log")
+    {
+        options.log = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The generateInput() function builds a benchmark input of the given shape from a fixed seed, one shape per routing rule of
+adaptiveSort().
+    >> Parameters:
+            const string &pattern - random | sorted | nearlysorted (sorted, 1 in 1000 elements swapped with a close neighbour) |
+                                    reversed | fewunique (values 0 -> 3) | fewwide (4 values spread over every int)
+            int arraySize - Number of integers to generate
+    >> Return:
+            vector<int> - The generated input
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+vector<int> generateInput(const string &pattern, int arraySize)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+    uniform_int_distribution<int> fewValues(0, 3);
+    uniform_int_distribution<int> wideValues(INT_MIN, INT_MAX);
+
+    int spread[4]; // The 4 values of fewwide, spread over every int
+    for (int &value : spread)
+    {
+        value = wideValues(generator);
+    }
+
+    vector<int> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        if (pattern == "sorted" || pattern == "nearlysorted")
+        {
+            input[i] = i;
+        }
+        else if (pattern == "reversed")
+        {
+            input[i] = arraySize - i;
+        }
+        else if (pattern == "fewunique")
+        {
+            input[i] = fewValues(generator);
+        }
+        else if (pattern == "fewwide")
+        {
+            input[i] = spread[fewValues(generator)];
+        }
+        else
+        {
+            input[i] = distribution(generator);
+        }
+    }
+
+    if (pattern == "nearlysorted")
+    {
+        for (int i = 0; i + 8 < arraySize; i += 1000)
+        {
+            swap(input[i], input[i + 1 + (int)(generator() % 8)]);
+        }
+    }
+
+    return input;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            const EngineOptions &options - Tuning knobs of the engines
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, const EngineOptions &options, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size(), options);
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+const int INSERTION_BENCH_LIMIT = 50000; // Largest input the benchmark gives to the (unbounded) insertion engine when it is not sorted
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times every engine, the adaptive dispatcher (auto) & std::sort() on the same generated inputs, prints the
+engine the dispatcher picked for each of them, and checks every output against std::sort(). The insertion engine is skipped ("-") on
+inputs larger than INSERTION_BENCH_LIMIT unless they are (nearly) sorted, where it is the O(n) engine to beat.
+    >> Parameters:
+            int arraySize - Number of integers to sort
+            const EngineOptions &options - Tuning knobs of the engines
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize, const EngineOptions &options)
+{
+    const char *engines[] = {"insertion", "merge", "threeway", "quick", "radix", "counting", "auto"};
+    const char *patterns[] = {"random", "sorted", "nearlysorted", "reversed", "fewunique", "fewwide"};
+
+    cout << endl
+         << "Benchmark: " << arraySize << " integers (ms), stable=" << options.stable << endl
+         << "   " << left << setw(14) << "pattern" << right;
+    for (const char *engine : engines)
+    {
+        cout << setw(11) << engine;
+    }
+    cout << setw(11) << "std::sort" << "   picked" << endl;
+
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with std::sort()
+
+    for (const char *pattern : patterns)
+    {
+        vector<int> input = generateInput(pattern, arraySize);
+        cout << "   " << left << setw(14) << pattern << right;
+
+        for (const char *engine : engines)
+        {
+            bool presorted = (string(pattern) == "sorted" || string(pattern) == "nearlysorted");
+            if (string(engine) == "insertion" && !presorted && arraySize > INSERTION_BENCH_LIMIT)
+            {
+                cout << setw(11) << "-"; // O(n^2) -> Too slow to time
+                continue;
+            }
+
+            double milliseconds = timeEngine(engine, input, options, output);
+            allMatch = allMatch && is_sorted(output.begin(), output.end());
+            cout << setw(11) << fixed << setprecision(2) << milliseconds;
+        }
+
+        vector<int> expected = input;
+        auto start = chrono::steady_clock::now();
+        sort(expected.begin(), expected.end());
+        auto stop = chrono::steady_clock::now();
+        allMatch = allMatch && (output == expected); // The last engine timed is auto
+
+        output = input;
+        SortDecision decision = adaptiveSort(output.data(), arraySize, options.stable != 0);
+        cout << setw(11) << chrono::duration<double, milli>(stop - start).count() << "   " << decision.engine
+             << ((decision.insertionGaveUp) ? " (insertion gave up)" : "") << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+
+    if (options.log != 0) // Full decisions, for tuning the thresholds
+    {
+        cout << endl;
+        for (const char *pattern : patterns)
+        {
+            output = generateInput(pattern, arraySize);
+            cout << "   " << left << setw(14) << pattern << right;
+            adaptiveSort(output.data(), arraySize, options.stable != 0, &cout);
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
+terminal before and after it is sorted.
+    >> Arguments:
+            argv[1] - Sorting engine to run: auto (default) | insertion | merge | threeway | quick | radix | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 1000000)
+            argv[3...] - Engine options of the form option=value (stable=0, log=1)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "auto"; // Sorting engine selected on the command line
+    EngineOptions options;                         // Tuning knobs selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000, options);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Running " << engine << "..." << endl;
+    if (!sortWithEngine(engine, dataArray, arraySize, options, (options.log != 0) ? &cout : nullptr))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    // Print the sorted array
+    cout << endl
+         << "Array after sorting:";
+    printArray(dataArray, arraySize);
+    cout << endl;
+
+    return 0;
+}
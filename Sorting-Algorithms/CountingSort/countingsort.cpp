@@ -0,0 +1,517 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> COUNTINGSORT - NARROW RANGE FRONT-END <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This countingsort.cpp file is a personal reference of the CountingSort algorithm, and of a sort front-end that uses it whenever the input
+allows. Comparison sorts cannot beat n*log(n) comparisons, but when the integers only take (k) different values in a narrow range
+[min, max] (data3.txt holds 63 integers from 0 to 3), CountingSort sorts them in O(n + k) without comparing two elements: it counts how
+often every value occurs, and rewrites the array from the counts. The front-end learns the range while the input is parsed (at no extra
+cost), and only uses CountingSort when the range is narrow enough; otherwise it falls back to a comparison sort.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Range Detection: main() updates the minimum & maximum as every integer is read from the data file, so the range
+        (k = max - min + 1) is known before sorting starts, without an extra pass over the array. sortFrontEnd() computes them with one
+        pass when the array did not come from a file (e.g. the benchmark).
+
+>> Front-End Dispatch: CountingSort needs (k) counters, and costs O(n + k) time. When (k) is at most (ratio * n) (default ratio = 4),
+        the counters take no more memory than a few copies of the array, and CountingSort beats an O(n*log(n)) sort, so sortFrontEnd()
+        uses it. Wider ranges (e.g. data1.txt: 50 integers from -512 to 8301) are sorted with the fallback comparison sort (std::sort()).
+        The range is computed in 64-bit arithmetic, so (INT_MIN -> INT_MAX) cannot overflow.
+
+>> CountingSort: Accepts a pointer to an array, its size & its range [min, max]. A histogram of (k) counters is built in one pass over
+        the array (counter [value - min] is incremented), and the array is then rewritten in one pass over the histogram: every value is
+        written as many times as it was counted, in increasing order. The histogram is returned as a by-product when requested, and the
+        counting engine prints it (histogram=1).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Stable Algorithm: This CountingSort rewrites the values from their counts, so there are no original elements left to reorder. Equal
+                     integers are indistinguishable, so the output is the same as that of a stable sort. (Sorting records by key needs
+                     the prefix-sum variant that moves every record to its own position.)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        All-cases: O(n + k) - One pass over the (n) elements to count them, and one pass over the (k) counters to rewrite the array.
+                                 O(n) - Histogram pass, n = # elements in array
+                                  + (plus)
+                                 O(k) - Rewrite pass, k = max - min + 1 (# of possible values)
+                                  = O(n + k)
+
+        Front-End: O(n + k) when (k <= ratio * n) -> O(n), otherwise O(n*log(n)) (fallback comparison sort)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        All-cases: O(k) - One counter per possible value. The array itself is rewritten in place.
+                             O(k) - Histogram, k = max - min + 1
+                              = O(k)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example CountingSort Execution:
+        Key: {} = Array, [] = Histogram (counter [value - min])
+        Array = {2, 0, 3, 0, 1, 0}; min = 0, max = 3 (found while parsing), k = 4 <= 4 * 6 -> CountingSort
+
+            (1) Histogram Pass: {2, 0, 3, 0, 1, 0} -> [0]: 3, [1]: 1, [2]: 1, [3]: 1
+            (2) Rewrite Pass: [0] x 3 -> {0, 0, 0, , , }
+                              [1] x 1 -> {0, 0, 0, 1, , }
+                              [2] x 1 -> {0, 0, 0, 1, 2, }
+                              [3] x 1 -> {0, 0, 0, 1, 2, 3}
+
+        * SORTED: arr[] = {0, 0, 0, 1, 2, 3}
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ countingsort.cpp || g++ countingsort.cpp -g -o countingsort
+        ./a.out || valgrind ./a.out || valgrind ./countingsort || valgrind --leak-check=full ./countingsort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = auto (default, front-end) | counting | fallback | bench
+            dataFile = data3.txt (default), or the number of random integers to sort when benchmarking (default 1000000)
+            options = ratio=4 (largest range k, as a multiple of n, sorted by CountingSort in the auto engine)
+                      histogram=0 (1 = print the histogram built by CountingSort)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <climits>   // INT_MAX, INT_MIN
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort
+
+using namespace std;
+
+const long long MAX_COUNTING_RANGE = 1LL << 28; // Largest range (k) the counting engine accepts (1 GB of counters)
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The countingSort() function sorts the array, whose elements all lie in [minimum, maximum], by counting every value & rewriting the
+array from the counts.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int minimum - Smallest element of the array
+            int maximum - Largest element of the array
+            vector<int> *histogram - Optional, receives the counts (entry [value - minimum]), nullptr = not needed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void countingSort(int dataArray[], int arraySize, int minimum, int maximum, vector<int> *histogram = nullptr)
+{
+    if (arraySize < 2)
+    {
+        if (histogram != nullptr)
+        {
+            histogram->assign((arraySize == 1) ? 1 : 0, arraySize); // One counter (or none)
+        }
+        return;
+    }
+
+    size_t range = (size_t)((long long)maximum - (long long)minimum + 1); // k = # of possible values
+    vector<int> counts(range, 0);
+
+    for (int i = 0; i < arraySize; i++) // Histogram pass
+    {
+        counts[(size_t)((long long)dataArray[i] - minimum)]++;
+    }
+
+    int index = 0;
+    for (size_t value = 0; value < range; value++) // Rewrite pass
+    {
+        int element = (int)((long long)minimum + (long long)value);
+        for (int count = counts[value]; count > 0; count--)
+        {
+            dataArray[index++] = element;
+        }
+    }
+
+    if (histogram != nullptr)
+    {
+        histogram->swap(counts);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The findRange() function computes the minimum & maximum of the array in one pass (for arrays that were not parsed by main()).
+    >> Parameters:
+            const int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array (at least 1)
+            int &minimum - Receives the smallest element
+            int &maximum - Receives the largest element
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void findRange(const int dataArray[], int arraySize, int &minimum, int &maximum)
+{
+    minimum = INT_MAX;
+    maximum = INT_MIN;
+
+    for (int i = 0; i < arraySize; i++)
+    {
+        minimum = (dataArray[i] < minimum) ? dataArray[i] : minimum;
+        maximum = (dataArray[i] > maximum) ? dataArray[i] : maximum;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The useCountingSort() function decides whether the front-end sorts a range with CountingSort.
+    >> Parameters:
+            int arraySize - Size of the array
+            int minimum - Smallest element of the array
+            int maximum - Largest element of the array
+            int ratio - Largest range (k), as a multiple of the array size, that is sorted with CountingSort
+    >> Return:
+            bool - True if (k = max - min + 1) is at most (ratio * n) (and at most MAX_COUNTING_RANGE)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool useCountingSort(int arraySize, int minimum, int maximum, int ratio)
+{
+    long long range = (long long)maximum - (long long)minimum + 1;
+    return range <= (long long)ratio * arraySize && range <= MAX_COUNTING_RANGE;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortFrontEnd() function sorts the array with CountingSort when its range is narrow (see useCountingSort()), and with the fallback
+comparison sort (std::sort()) otherwise. The range is computed with findRange() unless the caller already knows it.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int ratio - Largest range (k), as a multiple of the array size, that is sorted with CountingSort
+            const int *knownMinimum - Optional smallest element, found while parsing (nullptr = compute it)
+            const int *knownMaximum - Optional largest element, found while parsing (nullptr = compute it)
+    >> Return:
+            bool - True if CountingSort was used
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortFrontEnd(int dataArray[], int arraySize, int ratio, const int *knownMinimum = nullptr, const int *knownMaximum = nullptr)
+{
+    if (arraySize < 2)
+    {
+        return false; // Already sorted
+    }
+
+    int minimum = 0;
+    int maximum = 0;
+    if (knownMinimum != nullptr && knownMaximum != nullptr)
+    {
+        minimum = *knownMinimum;
+        maximum = *knownMaximum;
+    }
+    else
+    {
+        findRange(dataArray, arraySize, minimum, maximum);
+    }
+
+    if (useCountingSort(arraySize, minimum, maximum, ratio))
+    {
+        countingSort(dataArray, arraySize, minimum, maximum);
+        return true;
+    }
+
+    sort(dataArray, dataArray + arraySize); // Wide range -> Fallback comparison sort
+    return false;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the tuning knobs of the sorting engines, which can be set on the command line as option=value.
+    >> Members:
+            int ratio - Largest range (k), as a multiple of n, that the auto engine sorts with CountingSort
+            int histogram - 1 to print the histogram built by the counting engine
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    int ratio = 4;
+    int histogram = 0;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Tuning knobs of the engines to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    int value = atoi(argument.c_str() + separator + 1);
+
+    if (name == "ratio")
+    {
+        options.ratio = value;
+    }
+    else if (name == "histogram")
+    {
+        options.histogram = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times CountingSort, std::sort() & the front-end on random inputs of increasing range (k), from 4 values up
+to every int (generated from a fixed seed), and checks every output against std::sort(). The last column shows which sort the front-end
+picked.
+    >> Parameters:
+            int arraySize - Number of integers to sort
+            const EngineOptions &options - Tuning knobs of the engines
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize, const EngineOptions &options)
+{
+    const long long ranges[] = {4, 256, 65536, (long long)arraySize, 4LL * arraySize, 16LL * arraySize, 1LL << 32};
+
+    cout << endl
+         << "Benchmark: " << arraySize << " integers (ms), ratio=" << options.ratio << endl
+         << "   " << left << setw(14) << "range (k)" << right << setw(12) << "counting" << setw(12) << "std::sort" << setw(12)
+         << "front-end" << "   picked" << endl;
+
+    vector<int> input(arraySize);
+    vector<int> reference;
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with the reference output
+
+    for (long long range : ranges)
+    {
+        mt19937 generator(12345);
+        uniform_int_distribution<long long> distribution(0, range - 1);
+        for (int i = 0; i < arraySize; i++)
+        {
+            input[i] = (int)(distribution(generator) + INT_MIN); // Start at INT_MIN so the widest range covers every int
+        }
+
+        reference = input;
+        auto start = chrono::steady_clock::now();
+        sort(reference.begin(), reference.end());
+        auto stop = chrono::steady_clock::now();
+        double sortMilliseconds = chrono::duration<double, milli>(stop - start).count();
+
+        string counting = "-"; // Not attempted above MAX_COUNTING_RANGE
+        if (range <= MAX_COUNTING_RANGE)
+        {
+            output = input;
+            int minimum = 0;
+            int maximum = 0;
+            start = chrono::steady_clock::now();
+            findRange(output.data(), arraySize, minimum, maximum);
+            countingSort(output.data(), arraySize, minimum, maximum);
+            stop = chrono::steady_clock::now();
+            allMatch = allMatch && (output == reference);
+
+            stringstream formatted;
+            formatted << fixed << setprecision(2) << chrono::duration<double, milli>(stop - start).count();
+            counting = formatted.str();
+        }
+
+        output = input;
+        start = chrono::steady_clock::now();
+        bool picked = sortFrontEnd(output.data(), arraySize, options.ratio);
+        stop = chrono::steady_clock::now();
+        allMatch = allMatch && (output == reference);
+
+        cout << "   " << left << setw(14) << range << right << setw(12) << counting << setw(12) << fixed << setprecision(2)
+             << sortMilliseconds << setw(12) << chrono::duration<double, milli>(stop - start).count() << "   "
+             << (picked ? "counting" : "fallback") << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation, and tracks the minimum & maximum while
+parsing. The first line of the data file contains the # of integers to be sorted, and the following lines contain the data to be
+populated to the array. The array is then printed to the terminal before and after it is sorted.
+    >> Arguments:
+            argv[1] - Sorting engine to run: auto (default, front-end) | counting | fallback | bench
+            argv[2] - Data file to read (default data3.txt), or the number of random integers to sort for bench (default 1000000)
+            argv[3...] - Engine options of the form option=value (ratio=4, histogram=0)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "auto"; // Sorting engine selected on the command line
+    EngineOptions options;                         // Tuning knobs selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000, options);
+        return 0;
+    }
+
+    if (engine != "auto" && engine != "counting" && engine != "fallback")
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data3.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0;         // Index to insert element into dataArray
+    int minimum = INT_MAX; // Smallest integer read so far
+    int maximum = INT_MIN; // Largest integer read so far
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+
+            minimum = (element < minimum) ? element : minimum; // Track the range while parsing
+            maximum = (element > maximum) ? element : maximum;
+        }
+    }
+
+    if (index == 0) // No integers read -> No range
+    {
+        cerr << "ERROR - No Integers Found" << endl;
+        return 1;
+    }
+
+    arraySize = index; // Fewer integers than announced -> Only sort the (index) integers read, the rest of the array is unset
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Range: " << minimum << " -> " << maximum << " (k = " << ((long long)maximum - minimum + 1) << ", n = " << arraySize << ")"
+         << endl;
+
+    if (engine == "counting")
+    {
+        if ((long long)maximum - minimum + 1 > MAX_COUNTING_RANGE)
+        {
+            cerr << "ERROR - Range Too Wide For CountingSort" << endl;
+            return 1;
+        }
+
+        cout << "Running CountingSort (counting)..." << endl;
+        vector<int> histogram;
+        countingSort(dataArray, arraySize, minimum, maximum, (options.histogram != 0) ? &histogram : nullptr);
+
+        for (size_t value = 0; value < histogram.size(); value++) // Empty unless histogram=1
+        {
+            if (histogram[value] > 0)
+            {
+                cout << "   " << setw(8) << ((long long)minimum + (long long)value) << ": " << histogram[value] << endl;
+            }
+        }
+    }
+    else if (engine == "fallback")
+    {
+        cout << "Running fallback comparison sort (fallback)..." << endl;
+        sort(dataArray, dataArray + arraySize);
+    }
+    else
+    {
+        bool counted = sortFrontEnd(dataArray, arraySize, options.ratio, &minimum, &maximum);
+        cout << "Ran " << (counted ? "CountingSort" : "fallback comparison sort") << " (auto)..." << endl;
+    }
+
+    // Print the sorted array
+    cout << endl
+         << "Array after sorting:";
+    printArray(dataArray, arraySize);
+    cout << endl;
+
+    return 0;
+}
@@ -0,0 +1,435 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> ARGSORT - SORTING LARGE RECORDS BY KEY <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This argsort.cpp file is a personal reference of argsort (key-index sorting), for records much larger than their keys (64 -> 256 byte
+records sorted by a 4-byte integer key). QuickSort & MergeSort move whole elements: every swap of QuickSort copies three records, and
+every level of MergeSort copies every record twice (to the buffer & back), so sorting n records moves O(n*log(n)) records' worth of
+payload bytes that the sort never even looks at. Argsort sorts the keys with their positions instead, and moves every record once at the
+end. The functions live in the header argsort.h, on top of the generic sorts of genericsort.h.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Pair Argsort: argsortPairs() copies the key of each record & its index into an array of 8-byte (key, index) pairs, sorts the pairs
+        (with quickSort(), mergeSort() or insertionSort(), picked by a policy struct), and returns the indices in sorted order: the
+        sorting permutation. The pairs are ordered by key, then by index, so no two are equal and even QuickSort returns the stable
+        order. Pairs with an arithmetic key get the branchless kernels of genericsort.h (BranchlessSort is specialized for them).
+
+>> Index Argsort: argsortIndices() sorts the index vector 0 -> n - 1 itself, with a comparator that reads the keys from the records. No
+        pair array is needed (4 bytes per record instead of 8), but every comparison loads two keys from records that are far apart in
+        memory, so it is slower than the pair argsort once the records no longer fit in the cache.
+
+>> Cycle-Following Permutation: applyPermutation() reorders the records in place. Position [k] must receive the record at
+        [permutation[k]], which must receive the record at [permutation[permutation[k]]], and so on until the cycle returns to (k). The
+        record at (k) is moved out, each record of the cycle is moved into the hole left by the previous one, and the held record closes
+        the cycle. Every record is moved exactly once, plus one extra move per cycle of length two or more, and the permutation itself
+        marks the records already placed (no extra memory).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Payload Traffic: The Record struct counts its own copies, so the benchmark reports the payload bytes every method moves. On 1000000
+        random records, sorting the records directly with quickSort() copies every record ~17 times and mergeSort() ~29 times, while the
+        argsort copies every record once (applyPermutation()), a 17x -> 29x reduction of payload traffic. The sorts themselves only
+        move 8-byte pairs (or 4-byte indices). The wall-clock gain is smaller than the traffic reduction: applyPermutation() reads the
+        records in random order (a cache miss per record), so the pair argsort only overtakes quickSort() on the records themselves
+        from ~128-byte records up, and the index argsort (two scattered key loads per comparison) is the slowest method.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Stable Algorithm: Both argsorts break ties by index, so records with equal keys keep their relative order, whatever the engine.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        Argsort: O(n*log(n)) - The sort of the pairs or indices (QuickSort & MergeSort engines), plus O(n) to build & read the pairs
+        Apply: O(n) - Every record is moved once, and every entry of the permutation is visited once
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        Pair Argsort: O(n) - 8-byte pairs & the 4-byte permutation (MergeSort adds a buffer of n/2 pairs)
+        Index Argsort: O(n) - The 4-byte permutation (MergeSort adds a buffer of n/2 indices)
+        Apply: O(1) - One held record, in place
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example Argsort Execution:
+        Key: {} = Records (key:payload), [] = Pairs / Permutation
+        Records = {30:A, 10:B, 20:C, 10:D}
+
+            (1) Pairs: [(30, 0), (10, 1), (20, 2), (10, 3)]
+            (2) Sorted Pairs: [(10, 1), (10, 3), (20, 2), (30, 0)] -> Permutation: [1, 3, 2, 0]
+            (3) Apply, cycle from [0]: hold 30:A, [0] <- [1] = 10:B, [1] <- [3] = 10:D, [3] <- held 30:A
+                                       (permutation[3] = 0 closes the cycle), [2] is already in place
+
+        * SORTED: Records = {10:B, 10:D, 20:C, 30:A}, 4 record moves (3 records + 1 for the cycle)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ -std=c++17 argsort.cpp || g++ -std=c++17 argsort.cpp -g -o argsort
+        ./a.out || valgrind ./a.out || valgrind ./argsort || valgrind --leak-check=full ./argsort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = pairs (default) | indices | direct (sort the records themselves) | bench
+            dataFile = data1.txt (default), or the number of random records to sort when benchmarking (default 1000000)
+            options = sort=quick (default) | merge (engine used to sort the pairs, indices or records)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>        // cout
+#include <fstream>         // ifstream
+#include <sstream>         // stringstream
+#include <string>          // string
+#include <cstdint>         // uint32_t
+#include <cstdlib>         // atoi
+#include <cstring>         // memset, memcpy
+#include <vector>          // vector
+#include <random>          // mt19937
+#include <chrono>          // steady_clock
+#include <iomanip>         // setw, setprecision
+#include "argsort.h"       // generic::argsortPairs, argsortIndices, applyPermutation
+
+using namespace std;
+
+long long recordCopies = 0; // # of Record copies (constructions & assignments) since the last reset
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The Record struct is a record of (Bytes) bytes sorted by its integer key. The payload holds the record's original position followed by
+a fill byte derived from the key, so the demo can check that every payload travelled with its key. Every copy of a record is counted in
+recordCopies, which measures the payload traffic of a sort.
+    >> Members:
+            int key - Sort key
+            uint32_t position - Original position of the record (start of the payload)
+            unsigned char fill[] - Rest of the payload, every byte = (key & 0xFF)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int Bytes>
+struct Record
+{
+    int key;
+    uint32_t position;
+    unsigned char fill[Bytes - sizeof(int) - sizeof(uint32_t)];
+
+    Record() : key(0), position(0)
+    {
+        memset(fill, 0, sizeof(fill));
+    }
+
+    Record(int recordKey, uint32_t recordPosition) : key(recordKey), position(recordPosition)
+    {
+        memset(fill, recordKey & 0xFF, sizeof(fill));
+    }
+
+    Record(const Record &other) : key(other.key), position(other.position)
+    {
+        memcpy(fill, other.fill, sizeof(fill));
+        recordCopies++;
+    }
+
+    Record &operator=(const Record &other)
+    {
+        key = other.key;
+        position = other.position;
+        memcpy(fill, other.fill, sizeof(fill));
+        recordCopies++;
+        return *this;
+    }
+
+    bool operator<(const Record &other) const
+    {
+        return key < other.key;
+    }
+};
+
+static_assert(sizeof(Record<64>) == 64 && sizeof(Record<256>) == 256, "Records have exactly (Bytes) bytes");
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The recordKey() function returns the key of a record, the keyOf() function passed to the argsorts.
+    >> Parameters:
+            const Record<Bytes> &record - Record to take the key of
+    >> Return:
+            int - The key
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int Bytes>
+int recordKey(const Record<Bytes> &record)
+{
+    return record.key;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortRecords() function sorts the records by key with the named method.
+    >> Parameters:
+            const string &engine - pairs (argsortPairs() + applyPermutation()) | indices (argsortIndices() + applyPermutation()) |
+                                   direct (the records themselves)
+            const string &sort - quick | merge (engine used to sort the pairs, indices or records)
+            vector<Record<Bytes>> &records - Records to be sorted
+    >> Return:
+            bool - False if the method or engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int Bytes>
+bool sortRecords(const string &engine, const string &sort, vector<Record<Bytes>> &records)
+{
+    bool merge = (sort == "merge");
+    if (!merge && sort != "quick")
+    {
+        return false;
+    }
+
+    if (engine == "pairs" || engine == "indices")
+    {
+        vector<uint32_t> permutation;
+        if (engine == "pairs")
+        {
+            permutation = merge ? generic::argsortPairs<generic::MergeSortPolicy>(records.begin(), records.end(), recordKey<Bytes>)
+                                : generic::argsortPairs<generic::QuickSortPolicy>(records.begin(), records.end(), recordKey<Bytes>);
+        }
+        else
+        {
+            permutation = merge ? generic::argsortIndices<generic::MergeSortPolicy>(records.begin(), records.end(), recordKey<Bytes>)
+                                : generic::argsortIndices<generic::QuickSortPolicy>(records.begin(), records.end(), recordKey<Bytes>);
+        }
+        generic::applyPermutation(records.begin(), permutation);
+    }
+    else if (engine == "direct")
+    {
+        if (merge)
+        {
+            generic::mergeSort(records.begin(), records.end());
+        }
+        else
+        {
+            generic::quickSort(records.begin(), records.end());
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The checkRecords() function checks a sorted range of records: keys in order, every payload still matching its key, and (if stable is
+true) records with equal keys still in their original order.
+    >> Parameters:
+            const vector<Record<Bytes>> &records - Sorted records
+            bool stable - True to also check the stable order
+    >> Return:
+            bool - True if every check passes
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int Bytes>
+bool checkRecords(const vector<Record<Bytes>> &records, bool stable)
+{
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        for (unsigned char byte : records[i].fill)
+        {
+            if (byte != (unsigned char)(records[i].key & 0xFF))
+            {
+                return false; // The payload was separated from its key
+            }
+        }
+
+        if (i > 0 && (records[i].key < records[i - 1].key ||
+                      (stable && records[i].key == records[i - 1].key && records[i].position < records[i - 1].position)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The benchmarkRecords() function prints the benchmark rows of one record size: every method & engine sorts the same random records, and
+its time, the payload it moved (record copies * record size) & the traffic reduction against quickSort() on the records are printed.
+    >> Parameters:
+            int recordCount - Number of records to sort
+    >> Return:
+            bool - True if every output passes checkRecords()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int Bytes>
+bool benchmarkRecords(int recordCount)
+{
+    const char *engines[] = {"direct", "pairs", "indices"};
+    const char *sorts[] = {"quick", "merge"};
+
+    mt19937 generator(12345);
+    vector<Record<Bytes>> input;
+    input.reserve(recordCount);
+    for (int i = 0; i < recordCount; i++)
+    {
+        input.emplace_back((int)(generator() % 2000001) - 1000000, (uint32_t)i);
+    }
+
+    bool allMatch = true;
+    double directTraffic = 0; // Payload bytes moved by quickSort() on the records
+    vector<Record<Bytes>> records;
+
+    for (const char *engine : engines)
+    {
+        for (const char *sort : sorts)
+        {
+            records = input;
+            recordCopies = 0;
+
+            auto start = chrono::steady_clock::now();
+            sortRecords(engine, sort, records);
+            auto stop = chrono::steady_clock::now();
+
+            double traffic = (double)recordCopies * Bytes;
+            directTraffic = (directTraffic == 0) ? traffic : directTraffic;
+            allMatch = allMatch && checkRecords(records, string(engine) != "direct" || string(sort) == "merge");
+
+            cout << "   " << setw(6) << Bytes << "   " << left << setw(10) << engine << setw(8) << sort << right << setw(12) << fixed
+                 << setprecision(2) << chrono::duration<double, milli>(stop - start).count() << setw(14) << setprecision(1)
+                 << traffic / 1e6 << setw(12) << setprecision(2) << (double)recordCopies / recordCount << setw(10)
+                 << setprecision(1) << directTraffic / traffic << "x" << endl;
+        }
+    }
+
+    return allMatch;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function benchmarks every method on records of 64, 128 & 256 bytes.
+    >> Parameters:
+            int recordCount - Number of records to sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int recordCount)
+{
+    cout << endl
+         << "Benchmark: " << recordCount << " random records" << endl
+         << "   " << setw(6) << "bytes" << "   " << left << setw(10) << "method" << setw(8) << "sort" << right << setw(12) << "ms"
+         << setw(14) << "payload MB" << setw(12) << "copies/rec" << setw(11) << "reduction" << endl;
+
+    bool allMatch = benchmarkRecords<64>(recordCount);
+    allMatch = benchmarkRecords<128>(recordCount) && allMatch;
+    allMatch = benchmarkRecords<256>(recordCount) && allMatch;
+
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printKeys() function traverses the records and prints their keys out to the terminal, in the same reader friendly format as the
+other programs.
+    >> Parameters:
+            const vector<Record<Bytes>> &records - Records to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int Bytes>
+void printKeys(const vector<Record<Bytes>> &records)
+{
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+
+        int key = records[i].key;
+        cout << ((key < 10) ? " " : "") << key << ((i == records.size() - 1) ? "\n" : ", ");
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the keys of the 128-byte records to be sorted. The keys are printed to the
+terminal before and after the records are sorted.
+    >> Arguments:
+            argv[1] - Method to run: pairs (default) | indices | direct | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random records to sort for bench (default 1000000)
+            argv[3...] - Options of the form option=value (sort=quick)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "pairs"; // Method selected on the command line
+    string sort = "quick";                          // Engine selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        string argument = argv[i];
+        if (argument.rfind("sort=", 0) != 0)
+        {
+            cerr << "ERROR - Invalid Option: " << argument << endl;
+            return 1;
+        }
+        sort = argument.substr(5);
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;   // Number of records to be sorted
+    infile >> arraySize; // Size is first line of data file
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    vector<Record<128>> records; // To hold our records to be sorted
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && ((int)records.size() < arraySize))
+        {
+            records.emplace_back(element, (uint32_t)records.size());
+        }
+    }
+
+    // Print unsorted keys
+    cout << endl
+         << "Array before sorting:";
+    printKeys(records);
+
+    recordCopies = 0;
+    if (!sortRecords(engine, sort, records))
+    {
+        cerr << "ERROR - Unknown Method Or Engine: " << engine << ", sort=" << sort << endl;
+        return 1;
+    }
+
+    cout << endl
+         << "Sorted " << records.size() << " records of " << sizeof(Record<128>) << " bytes with " << engine << " (sort=" << sort
+         << "), " << recordCopies << " record copies, payload check: "
+         << (checkRecords(records, engine != "direct" || sort == "merge") ? "OK" : "MISMATCH") << endl;
+
+    // Print the sorted keys
+    cout << endl
+         << "Array after sorting:";
+    printKeys(records);
+    cout << endl;
+
+    return 0;
+}
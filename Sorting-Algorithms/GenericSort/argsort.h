@@ -0,0 +1,235 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> ARGSORT.H - KEY-INDEX SORTING & IN-PLACE PERMUTATION <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This header sorts records by a key without moving the records: it sorts small (key, index) pairs or an index (permutation) vector with
+the generic sorts of genericsort.h, and returns the permutation that sorts the records. applyPermutation() then moves every record to its
+place once, in place, by following the cycles of the permutation. Like genericsort.h, everything lives in namespace generic. See
+argsort.cpp for the description, the demo & the benchmark.
+    >> Templates & Functions:
+            argsortPairs<Policy>(first, last, keyOf) - Sorts (key, index) pairs, returns the sorting permutation
+            argsortIndices<Policy>(first, last, keyOf) - Sorts the indices by the keys of the records, returns the sorting permutation
+            applyPermutation(first, permutation) - Reorders the records in place so that record [k] becomes record [permutation[k]]
+            Policy = QuickSortPolicy (default) | MergeSortPolicy | InsertionSortPolicy, keyOf(record) returns the key of a record
+            Index = std::uint32_t (default, 8-byte pairs for 32-bit keys), pass a wider type (e.g. std::size_t) past 2^32 - 1 records
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#ifndef ARGSORT_H
+#define ARGSORT_H
+
+#include <cstdint>         // uint32_t
+#include <limits>          // numeric_limits
+#include <stdexcept>       // length_error
+#include <utility>         // move
+#include <vector>          // vector
+#include "genericsort.h"   // quickSort, mergeSort, insertionSort, BranchlessSort, IndexOf, ValueOf
+
+namespace generic
+{
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The KeyIndex struct is one entry of the pair array sorted by argsortPairs(): the key of a record & the record's position. Entries are
+ordered by key, then by index, so no two entries are equal and every engine (stable or not) produces the stable order of the records.
+A 32-bit key & index make an 8-byte entry, so a cache line holds 8 entries against 1 record of 64 bytes or more.
+    >> Members:
+            Key key - Key of the record
+            Index index - Position of the record in the unsorted range
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Key, typename Index>
+struct KeyIndex
+{
+    Key key;
+    Index index;
+
+    bool operator<(const KeyIndex &other) const
+    {
+        return (key < other.key) || (!(other.key < key) && index < other.index);
+    }
+};
+
+template <typename Key, typename Index>
+struct BranchlessSort<KeyIndex<Key, Index>> : BranchlessSort<Key> // Entries with an arithmetic key are small -> Branchless kernels
+{
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sort policies pick the generic engine of argsortPairs() & argsortIndices() at compile time (a struct with a static sort() function,
+like the pivot policies of QuickSort-Hoare's/quicksort.cpp).
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct QuickSortPolicy
+{
+    template <typename Iterator, typename Compare>
+    static void sort(Iterator first, Iterator last, Compare comp)
+    {
+        quickSort(first, last, comp);
+    }
+};
+
+struct MergeSortPolicy
+{
+    template <typename Iterator, typename Compare>
+    static void sort(Iterator first, Iterator last, Compare comp)
+    {
+        mergeSort(first, last, comp);
+    }
+};
+
+struct InsertionSortPolicy
+{
+    template <typename Iterator, typename Compare>
+    static void sort(Iterator first, Iterator last, Compare comp)
+    {
+        insertionSort(first, last, comp);
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The indexFits() function checks the precondition of both argsorts: every position 0 -> size - 1 of the range must fit in (Index), or
+the (Index) casts would silently wrap & the permutation would point at the wrong records. The default 32-bit Index covers up to
+2^32 - 1 records; larger ranges must pass a wider Index (e.g. argsortPairs<QuickSortPolicy, std::size_t>()). Both argsorts check it in
+every build (not only with assertions enabled), and throw std::length_error when it does not hold.
+    >> Parameters:
+            Size size - # of records in the range
+    >> Return:
+            bool - true if the last position (size - 1) fits in (Index)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Index, typename Size>
+bool indexFits(Size size)
+{
+    return (size <= 0) || ((unsigned long long)(size - 1) <= (unsigned long long)std::numeric_limits<Index>::max());
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The argsortPairs() function returns the permutation that sorts the records of [first, last) by key (stable). The key of every record is
+read once into a compact array of KeyIndex pairs, the pairs are sorted with the policy's engine (which only moves pairs), and the
+indices are read back out. The records themselves are not touched. Throws std::length_error if the
+positions of the range do not fit in (Index).
+    >> Parameters:
+            Iterator first - Iterator to the first record
+            Iterator last - Iterator past the last record
+            KeyOf keyOf - Returns the key of a record, keyOf(record)
+    >> Return:
+            std::vector<Index> - permutation[k] = position of the record that belongs at position [k]
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Policy = QuickSortPolicy, typename Index = std::uint32_t, typename Iterator, typename KeyOf>
+std::vector<Index> argsortPairs(Iterator first, Iterator last, KeyOf keyOf)
+{
+    typedef decltype(keyOf(*first)) KeyType;
+    typedef KeyIndex<typename std::decay<KeyType>::type, Index> Entry;
+
+    IndexOf<Iterator> size = last - first;
+    if (!indexFits<Index>(size))
+    {
+        throw std::length_error("Index too narrow for the range, pass a wider Index");
+    }
+    std::vector<Entry> entries(size);
+    for (IndexOf<Iterator> i = 0; i < size; i++)
+    {
+        entries[i] = Entry{keyOf(first[i]), (Index)i};
+    }
+
+    Policy::sort(entries.begin(), entries.end(), std::less<>());
+
+    std::vector<Index> permutation(size);
+    for (IndexOf<Iterator> i = 0; i < size; i++)
+    {
+        permutation[i] = entries[i].index;
+    }
+
+    return permutation;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The argsortIndices() function returns the same permutation as argsortPairs(), by sorting the index vector 0 -> n - 1 directly with a
+comparator that looks the keys up in the records (ties broken by index, so the order is stable). It needs no pair array, but every
+comparison loads two keys from the records, which are far apart in memory once the records are large. Throws std::length_error if
+the positions of the range do not fit in (Index).
+    >> Parameters:
+            Iterator first - Iterator to the first record
+            Iterator last - Iterator past the last record
+            KeyOf keyOf - Returns the key of a record, keyOf(record)
+    >> Return:
+            std::vector<Index> - permutation[k] = position of the record that belongs at position [k]
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Policy = QuickSortPolicy, typename Index = std::uint32_t, typename Iterator, typename KeyOf>
+std::vector<Index> argsortIndices(Iterator first, Iterator last, KeyOf keyOf)
+{
+    IndexOf<Iterator> size = last - first;
+    if (!indexFits<Index>(size))
+    {
+        throw std::length_error("Index too narrow for the range, pass a wider Index");
+    }
+    std::vector<Index> permutation(size);
+    for (IndexOf<Iterator> i = 0; i < size; i++)
+    {
+        permutation[i] = (Index)i;
+    }
+
+    Policy::sort(permutation.begin(), permutation.end(), [first, keyOf](Index a, Index b) {
+        const auto &keyA = keyOf(first[a]);
+        const auto &keyB = keyOf(first[b]);
+        return (keyA < keyB) || (!(keyB < keyA) && a < b);
+    });
+
+    return permutation;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The applyPermutation() function reorders the records of the range in place, so that record [k] becomes the record that was at position
+[permutation[k]]. Each cycle of the permutation is followed once: the first record of the cycle is moved out, every other record of the
+cycle is moved into the hole left by the previous one, and the first record fills the last hole. Every record is moved once (plus one
+extra move per cycle), instead of once per swap or merge step. The permutation is used to mark the placed records (entry [k] is set to
+k), so it is the identity when the function returns.
+    >> Parameters:
+            Iterator first - Iterator to the first record
+            std::vector<Index> &permutation - Sorting permutation (e.g. from argsortPairs()), left as the identity
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Index>
+void applyPermutation(Iterator first, std::vector<Index> &permutation)
+{
+    IndexOf<Iterator> size = (IndexOf<Iterator>)permutation.size();
+
+    for (IndexOf<Iterator> start = 0; start < size; start++)
+    {
+        if ((IndexOf<Iterator>)permutation[start] == start)
+        {
+            continue; // Already in place (or placed by an earlier cycle)
+        }
+
+        ValueOf<Iterator> held = std::move(first[start]); // First record of the cycle
+        IndexOf<Iterator> hole = start;
+
+        while ((IndexOf<Iterator>)permutation[hole] != start)
+        {
+            IndexOf<Iterator> source = permutation[hole];
+            first[hole] = std::move(first[source]); // The record that belongs in the hole
+            permutation[hole] = (Index)hole;
+            hole = source;
+        }
+
+        first[hole] = std::move(held); // Close the cycle
+        permutation[hole] = (Index)hole;
+    }
+}
+
+} // namespace generic
+
+#endif
@@ -0,0 +1,533 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> GENERIC SORTS - ITERATORS, COMPARATORS & ELEMENT TYPES <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This genericsort.cpp file is a personal reference of generic programming applied to the sorts of this repository. Every other program
+sorts an (int dataArray[]) with (int) indices, which limits it to one key type and to arrays of fewer than 2^31 elements. The header
+genericsort.h rewrites InsertionSort, MergeSort & QuickSort (with their merge() & partitionFunction() kernels) as templates over
+random-access iterators and a comparator, and this program sorts the same data as any element type, in any order.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Iterators & Indices: Every sort takes a range [first, last) of random-access iterators (pointers, std::vector & std::deque iterators,
+        ...), the convention of the C++ standard library, instead of an array & two inclusive indices. Sizes & offsets use the iterator's
+        difference_type (std::ptrdiff_t, 64 bits on 64-bit platforms), so a range may hold more than 2^31 elements.
+
+>> Comparators: Every sort takes a comparator, comp(a, b) = true if (a) goes before (b), std::less<>() by default. Any strict weak
+        ordering works: std::greater<>() sorts in descending order, a lambda can compare records by one key. The sorts only ever ask
+        comp(a, b), never a == b or a > b, so the element type needs no other operator. (NaN is not ordered by (<), so float & double
+        inputs must not contain it.)
+
+>> Compile-Time Kernel Selection: The fast kernels of this repository are branchless: the branchless Lomuto partition
+        (QuickSort-Lomuto's) and the branchless merge (MergeSort) turn each comparison into an index increment or a conditional move, so
+        random data costs no branch mispredictions. That pays off for elements that are cheap to copy, and costs extra copies for a
+        std::string or a record. if constexpr (BRANCHLESS<T>) picks the kernel per element type at compile time: arithmetic types
+        (int, int64_t, uint32_t, float, double...) get the branchless kernels, every other type gets Hoare's partition & the branchy
+        merge, which move elements only when they are out of place. The branch that is not taken is not even compiled, so the generic
+        sort of an int is the same machine code as a hand-written int kernel. BranchlessSort<T> can be specialized for other small types.
+
+>> Duplicates: Lomuto's scheme sends every copy of the pivot to the right side, so few unique values would make every partition
+        unbalanced. After an unbalanced branchless partition, quickSort() gathers the copies of the pivot in one more branchless pass
+        (skipEqual()) and skips them, like the three-way partition.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Stability: insertionSort() & mergeSort() are stable (equal elements keep their relative order), quickSort() is unstable. With
+              std::greater<>(), equal elements still keep their order in the stable sorts.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        insertionSort(): O(n^2) worst-case & average-case, O(n) on sorted input
+        mergeSort(): O(n*log(n)) in all cases, O(n) on sorted input (merges of ordered halves are skipped)
+        quickSort(): O(n*log(n)) average-case & worst-case (HeapSort after (2 * log2(n)) partitioning levels)
+        Each comparison costs whatever the comparator costs (O(length) for strings).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        insertionSort(): O(1)
+        mergeSort(): O(n) - One scratch buffer of (n / 2) elements, allocated once
+        quickSort(): O(log(n)) - Recursion on the smaller side only
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example Generic Sort Execution:
+        Array = {23, 1, 10, 5} as std::string, order=descending -> quickSort(first, last, std::greater<>())
+            (1) std::string is not BRANCHLESS -> Hoare's partitionFunction(), comparisons are lexicographic
+            (2) 4 elements <= 16 -> insertionSort(): {"5", "23", "10", "1"}
+
+        * SORTED: arr[] = {"5", "23", "10", "1"} (lexicographic, descending)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ -std=c++17 genericsort.cpp || g++ -std=c++17 genericsort.cpp -g -o genericsort
+        ./a.out || valgrind ./a.out || valgrind ./genericsort || valgrind --leak-check=full ./genericsort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = quick (default) | merge | insertion | bench
+            dataFile = data1.txt (default), or the number of random elements to sort when benchmarking (default 1000000)
+            options = type=int (default) | int64 | uint32 | float | double | string (the integers of the data file converted)
+                      order=ascending (default) | descending
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>        // cout
+#include <fstream>         // ifstream
+#include <sstream>         // stringstream
+#include <string>          // string, to_string
+#include <cstdint>         // int64_t, uint32_t
+#include <cstdlib>         // atoi
+#include <vector>          // vector
+#include <random>          // mt19937, uniform_int_distribution, uniform_real_distribution
+#include <chrono>          // steady_clock
+#include <iomanip>         // setw, setprecision
+#include <algorithm>       // sort, stable_sort, is_sorted
+#include <type_traits>     // is_arithmetic
+#include "genericsort.h"   // generic::insertionSort, mergeSort, quickSort, BRANCHLESS
+
+using namespace std;
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The Boxed struct wraps an int in a record with its own operator<. It is not arithmetic, so the generic sorts use their branchy kernels
+for it, which lets the benchmark compare both kernels on the same keys.
+    >> Members:
+            int value - The key
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct Boxed
+{
+    int value;
+
+    bool operator<(const Boxed &other) const
+    {
+        return value < other.value;
+    }
+
+    bool operator==(const Boxed &other) const
+    {
+        return value == other.value;
+    }
+};
+
+static_assert(generic::BRANCHLESS<int> && generic::BRANCHLESS<int64_t> && generic::BRANCHLESS<uint32_t> && generic::BRANCHLESS<float> &&
+                  generic::BRANCHLESS<double>,
+              "Arithmetic types use the branchless kernels");
+static_assert(!generic::BRANCHLESS<string> && !generic::BRANCHLESS<Boxed>, "Other types use the branchy kernels");
+static_assert(sizeof(generic::IndexOf<int *>) == sizeof(ptrdiff_t), "Sizes & offsets use ptrdiff_t, not int");
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the vector with the named generic engine and comparator.
+    >> Parameters:
+            const string &engine - quick | merge | insertion
+            vector<T> &data - Elements to be sorted
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T, typename Compare>
+bool sortWithEngine(const string &engine, vector<T> &data, Compare comp)
+{
+    if (engine == "quick")
+    {
+        generic::quickSort(data.begin(), data.end(), comp);
+    }
+    else if (engine == "merge")
+    {
+        generic::mergeSort(data.begin(), data.end(), comp);
+    }
+    else if (engine == "insertion")
+    {
+        generic::insertionSort(data.begin(), data.end(), comp);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the element type & the order selected on the command line as option=value.
+    >> Members:
+            string type - int | int64 | uint32 | float | double | string
+            string order - ascending | descending
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    string type = "int";
+    string order = "ascending";
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Options to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    string value = argument.substr(separator + 1);
+
+    if (name == "type" && (value == "int" || value == "int64" || value == "uint32" || value == "float" || value == "double" ||
+                           value == "string"))
+    {
+        options.type = value;
+    }
+    else if (name == "order" && (value == "ascending" || value == "descending"))
+    {
+        options.order = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The convertElement() function converts an integer of the data file to the selected element type. Integers convert exactly to int64,
+float & double, wrap around to uint32 (negative integers become very large), and are written in decimal for string.
+    >> Parameters:
+            long long element - Integer read from the data file
+    >> Return:
+            T - The converted element
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T>
+T convertElement(long long element)
+{
+    if constexpr (is_same<T, string>::value)
+    {
+        return to_string(element);
+    }
+    else
+    {
+        return (T)element;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given vector and prints the contents out to the terminal, in the same reader friendly format as
+the other programs (numbers less than 10 and one-character strings are padded with a space).
+    >> Parameters:
+            const vector<T> &data - Elements to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T>
+void printArray(const vector<T> &data)
+{
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+
+        bool pad = false; // Single-digit elements are padded with a space " "
+        if constexpr (is_arithmetic<T>::value)
+        {
+            pad = (data[i] < 10);
+        }
+        else
+        {
+            pad = (data[i].size() == 1);
+        }
+
+        cout << (pad ? " " : "") << data[i] << ((i == data.size() - 1) ? "\n" : ", ");
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortAndPrint() function converts the integers of the data file to the element type T, prints them, sorts them with the named
+engine in the selected order, and prints them again.
+    >> Parameters:
+            const string &engine - quick | merge | insertion
+            const vector<long long> &integers - Integers read from the data file
+            const EngineOptions &options - Element type & order
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T>
+bool sortAndPrint(const string &engine, const vector<long long> &integers, const EngineOptions &options)
+{
+    vector<T> data;
+    for (long long element : integers)
+    {
+        data.push_back(convertElement<T>(element));
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting (" << options.type << "):";
+    printArray(data);
+
+    bool known = (options.order == "descending") ? sortWithEngine(engine, data, greater<>()) : sortWithEngine(engine, data, less<>());
+    if (!known)
+    {
+        return false;
+    }
+
+    cout << endl
+         << "Sorted with " << engine << "Sort(), order=" << options.order << ", " << (generic::BRANCHLESS<T> ? "branchless" : "branchy")
+         << " kernels" << endl;
+
+    // Print the sorted array
+    cout << endl
+         << "Array after sorting:";
+    printArray(data);
+    cout << endl;
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The generateInput() function builds a random benchmark input of element type T from a fixed seed, so every run sorts the same data:
+integers spread over the whole type (int & uint32), -10^12 -> 10^12 (int64), -10^6 -> 10^6 (float & double), decimal strings of
+random ints, and Boxed ints.
+    >> Parameters:
+            int arraySize - Number of elements to generate
+    >> Return:
+            vector<T> - The generated input
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T>
+vector<T> generateInput(int arraySize)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<long long> wide(-1000000000000LL, 1000000000000LL);
+    uniform_real_distribution<double> real(-1000000.0, 1000000.0);
+
+    vector<T> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        if constexpr (is_same<T, string>::value)
+        {
+            input[i] = to_string((int)generator());
+        }
+        else if constexpr (is_same<T, Boxed>::value)
+        {
+            input[i] = Boxed{(int)generator()};
+        }
+        else if constexpr (is_same<T, int64_t>::value)
+        {
+            input[i] = wide(generator);
+        }
+        else if constexpr (is_floating_point<T>::value)
+        {
+            input[i] = (T)real(generator);
+        }
+        else
+        {
+            input[i] = (T)generator();
+        }
+    }
+
+    return input;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeSort() function sorts a copy of the input with the given sort function, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const vector<T> &input - Unsorted input (left unchanged)
+            vector<T> &output - Receives the sorted copy of the input
+            Sort sort - Called as sort(first, last)
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T, typename Sort>
+double timeSort(const vector<T> &input, vector<T> &output, Sort sort)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sort(output.begin(), output.end());
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The benchmarkType() function prints one benchmark row: the generic quickSort() & mergeSort() against std::sort() & std::stable_sort()
+on the same input of element type T, in the given order. Every output is checked against std::sort().
+    >> Parameters:
+            const string &label - Row label
+            int arraySize - Number of elements to sort
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+    >> Return:
+            bool - True if every output matches std::sort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T, typename Compare = less<>>
+bool benchmarkType(const string &label, int arraySize, Compare comp = Compare())
+{
+    vector<T> input = generateInput<T>(arraySize);
+    vector<T> expected;
+    vector<T> output;
+    bool allMatch = true;
+
+    double reference = timeSort(input, expected, [comp](auto first, auto last) { sort(first, last, comp); });
+    double quick = timeSort(input, output, [comp](auto first, auto last) { generic::quickSort(first, last, comp); });
+    allMatch = allMatch && (output == expected);
+    double merged = timeSort(input, output, [comp](auto first, auto last) { generic::mergeSort(first, last, comp); });
+    allMatch = allMatch && (output == expected);
+    double stable = timeSort(input, output, [comp](auto first, auto last) { stable_sort(first, last, comp); });
+
+    cout << "   " << left << setw(16) << label << right << setw(12) << fixed << setprecision(2) << quick << setw(12) << reference
+         << setw(12) << merged << setw(12) << stable << "   " << (generic::BRANCHLESS<T> ? "branchless" : "branchy") << endl;
+
+    return allMatch;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times the generic sorts on every element type of the demo, plus Boxed ints (same keys as int, branchy
+kernels) and descending ints (std::greater<>()), against the standard library sorts.
+    >> Parameters:
+            int arraySize - Number of elements to sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize)
+{
+    cout << endl
+         << "Benchmark: " << arraySize << " random elements (ms)" << endl
+         << "   " << left << setw(16) << "type" << right << setw(12) << "quickSort" << setw(12) << "std::sort" << setw(12)
+         << "mergeSort" << setw(12) << "stable_sort" << "   kernels" << endl;
+
+    bool allMatch = true;
+    allMatch = benchmarkType<int>("int", arraySize) && allMatch;
+    allMatch = benchmarkType<Boxed>("Boxed (int)", arraySize) && allMatch;
+    allMatch = benchmarkType<int>("int descending", arraySize, greater<>()) && allMatch;
+    allMatch = benchmarkType<int64_t>("int64", arraySize) && allMatch;
+    allMatch = benchmarkType<uint32_t>("uint32", arraySize) && allMatch;
+    allMatch = benchmarkType<float>("float", arraySize) && allMatch;
+    allMatch = benchmarkType<double>("double", arraySize) && allMatch;
+    allMatch = benchmarkType<string>("string", arraySize) && allMatch;
+
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The integers are converted to the
+selected element type, and printed to the terminal before and after they are sorted.
+    >> Arguments:
+            argv[1] - Generic sort to run: quick (default) | merge | insertion | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random elements to sort for bench (default 1000000)
+            argv[3...] - Options of the form option=value (type=int, order=ascending)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "quick"; // Generic sort selected on the command line
+    EngineOptions options;                          // Element type & order selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    long long arraySize = 0; // Number of integers to be sorted (Size of array)
+    infile >> arraySize;     // Size is first line of data file
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    vector<long long> integers; // To hold our data to be sorted
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        long long element;     // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && ((long long)integers.size() < arraySize))
+        {
+            integers.push_back(element);
+        }
+    }
+
+    bool known = false;
+    if (options.type == "int64")
+    {
+        known = sortAndPrint<int64_t>(engine, integers, options);
+    }
+    else if (options.type == "uint32")
+    {
+        known = sortAndPrint<uint32_t>(engine, integers, options);
+    }
+    else if (options.type == "float")
+    {
+        known = sortAndPrint<float>(engine, integers, options);
+    }
+    else if (options.type == "double")
+    {
+        known = sortAndPrint<double>(engine, integers, options);
+    }
+    else if (options.type == "string")
+    {
+        known = sortAndPrint<string>(engine, integers, options);
+    }
+    else
+    {
+        known = sortAndPrint<int>(engine, integers, options);
+    }
+
+    if (!known)
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,494 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> GENERICSORT.H - GENERIC SORTS OVER ITERATORS & COMPARATORS <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This header turns the sorts of this repository (insertionSort(), merge() & mergeSort(), partitionFunction() & quickSort()) into
+templates over random-access iterators and a comparator, indexed with the iterator's difference_type (std::ptrdiff_t for pointers &
+vector iterators), so they sort any element type and arrays of more than 2^31 elements. Element types for which BranchlessSort<T> is
+true (every arithmetic type by default: int64_t, uint32_t, float, double...) are routed with if constexpr to branchless partition &
+merge kernels, and every other type to the branchy kernels that move elements only when needed. The choice is made at compile time, so
+the generic call costs nothing over a hand-written kernel for the type. Everything lives in namespace generic, so the templates never
+collide with std::merge() & co. (through ADL) or with the int[] versions of the same names in the other programs. See genericsort.cpp for
+the description, the demo & the benchmark.
+    >> Templates & Functions:
+            insertionSort(first, last, comp) - Sorts [first, last) in place, stable
+            mergeSort(first, last, comp) - Sorts [first, last) with top-down MergeSort and one scratch buffer, stable
+            quickSort(first, last, comp) - Sorts [first, last) with IntroSort (QuickSort, HeapSort fallback), unstable
+            merge(first, middle, last, buffer, comp) & partitionFunction(first, last, comp) - The kernels of the two sorts
+            comp defaults to std::less<>, and must be a strict weak ordering (float & double must not contain NaN)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#ifndef GENERICSORT_H
+#define GENERICSORT_H
+
+#include <cstddef>     // ptrdiff_t
+#include <functional>  // less
+#include <iterator>    // iterator_traits
+#include <type_traits> // is_arithmetic
+#include <utility>     // move, swap
+#include <vector>      // vector
+
+namespace generic
+{
+
+const int GENERIC_INSERTION_CUTOFF = 16; // Sub-arrays of 16 or fewer elements are finished with insertionSort()
+const int GENERIC_NINTHER_MIN = 128;     // Sub-arrays of more than 128 elements are partitioned around Tukey's ninther
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The BranchlessSort trait selects the kernels for an element type. Branchless kernels do the same loads, stores & moves for every
+element whatever the comparisons return, which is a win when the elements are cheap to copy (the comparison result becomes an index
+increment or a conditional move instead of a mispredicted branch), and a loss when every move copies a string or a record. It is true
+for arithmetic types, and can be specialized for other small trivially copyable types.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T>
+struct BranchlessSort : std::is_arithmetic<T>
+{
+};
+
+template <typename T>
+constexpr bool BRANCHLESS = BranchlessSort<T>::value;
+
+template <typename Iterator>
+using ValueOf = typename std::iterator_traits<Iterator>::value_type; // Element type of an iterator
+
+template <typename Iterator>
+using IndexOf = typename std::iterator_traits<Iterator>::difference_type; // Index type of an iterator (std::ptrdiff_t for pointers)
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSort() function sorts [first, last) in place. Each element is moved out, the greater elements before it are shifted one
+position to the right, and the element is moved into the gap. Equal elements are never shifted past each other, so the sort is stable.
+    >> Parameters:
+            Iterator first - Iterator to the first element to be sorted
+            Iterator last - Iterator past the last element to be sorted
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare = std::less<>>
+void insertionSort(Iterator first, Iterator last, Compare comp = Compare())
+{
+    if (last - first < 2)
+    {
+        return;
+    }
+
+    for (Iterator i = first + 1; i != last; ++i)
+    {
+        ValueOf<Iterator> element = std::move(*i); // Element being inserted
+        Iterator index = i;                        // Gap left by the element
+
+        while (index != first && comp(element, *(index - 1))) // Shift every greater element one position to the right
+        {
+            *index = std::move(*(index - 1));
+            --index;
+        }
+
+        *index = std::move(element);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The merge() function merges the sorted ranges [first, middle) & [middle, last). The left range is moved to the buffer, and merged back
+from the left. Ties are taken from the left range, which keeps the merge stable. For BranchlessSort types the next element is picked
+with a conditional move, and both read positions advance by the result of the comparison (0 or 1), like
+MergeSort/mergesort.cpp's mergeArraysBranchless().
+    >> Parameters:
+            Iterator first - Iterator to the first element of the left range
+            Iterator middle - Iterator to the first element of the right range
+            Iterator last - Iterator past the last element of the right range
+            Buffer buffer - Random-access iterator to at least (middle - first) elements of scratch space
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Buffer, typename Compare = std::less<>>
+void merge(Iterator first, Iterator middle, Iterator last, Buffer buffer, Compare comp = Compare())
+{
+    IndexOf<Iterator> leftSize = middle - first;
+    for (IndexOf<Iterator> i = 0; i < leftSize; i++)
+    {
+        buffer[i] = std::move(first[i]);
+    }
+
+    Buffer left = buffer;               // Next element of the left range (in the buffer)
+    Buffer leftEnd = buffer + leftSize; // End of the left range
+    Iterator right = middle;            // Next element of the right range
+    Iterator output = first;            // Next output position
+
+    if constexpr (BRANCHLESS<ValueOf<Iterator>>)
+    {
+        while (left != leftEnd && right != last)
+        {
+            ValueOf<Iterator> leftElement = *left;
+            ValueOf<Iterator> rightElement = *right;
+            bool takeRight = comp(rightElement, leftElement); // Ties from the left -> Stable
+
+            *output = takeRight ? rightElement : leftElement; // Compiled to a conditional move, not a branch
+            ++output;
+            right += takeRight;
+            left += !takeRight;
+        }
+    }
+    else
+    {
+        while (left != leftEnd && right != last)
+        {
+            if (comp(*right, *left))
+            {
+                *output = std::move(*right);
+                ++right;
+            }
+            else
+            {
+                *output = std::move(*left);
+                ++left;
+            }
+            ++output;
+        }
+    }
+
+    while (left != leftEnd) // The rest of the right range is already in place
+    {
+        *output = std::move(*left);
+        ++output;
+        ++left;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSort() function (recursive part) sorts [first, last) with top-down MergeSort. Ranges of GENERIC_INSERTION_CUTOFF or fewer
+elements are sorted with insertionSort(), and two halves that are already in order are not merged.
+    >> Parameters:
+            Iterator first - Iterator to the first element to be sorted
+            Iterator last - Iterator past the last element to be sorted
+            Buffer buffer - Random-access iterator to at least (last - first + 1) / 2 elements of scratch space
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Buffer, typename Compare>
+void mergeSort(Iterator first, Iterator last, Buffer buffer, Compare comp)
+{
+    if (last - first <= GENERIC_INSERTION_CUTOFF)
+    {
+        insertionSort(first, last, comp);
+        return;
+    }
+
+    Iterator middle = first + (last - first + 1) / 2; // The left half is the larger one, so the buffer fits it
+    mergeSort(first, middle, buffer, comp);
+    mergeSort(middle, last, buffer, comp);
+
+    if (comp(*middle, *(middle - 1))) // Halves overlap -> Merge them
+    {
+        generic::merge(first, middle, last, buffer, comp); // Qualified: std::merge() would also match through ADL
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSort() function is the entry point of the generic MergeSort. It allocates the scratch buffer once (half the range, so the
+element type must be default constructible) and sorts [first, last). The sort is stable.
+    >> Parameters:
+            Iterator first - Iterator to the first element to be sorted
+            Iterator last - Iterator past the last element to be sorted
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b), std::less<>() by default
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare = std::less<>>
+void mergeSort(Iterator first, Iterator last, Compare comp = Compare())
+{
+    if (last - first < 2)
+    {
+        return;
+    }
+
+    std::vector<ValueOf<Iterator>> buffer((last - first + 1) / 2);
+    mergeSort(first, last, buffer.begin(), comp);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The siftDown() function restores the max-heap property (by comp) of the heap stored in [first, first + heapSize), by moving the element
+at heap position (root) down until both of its children are not greater.
+    >> Parameters:
+            Iterator first - Iterator to the first element of the heap
+            IndexOf<Iterator> root - Heap position of the element to be moved down
+            IndexOf<Iterator> heapSize - Number of elements in the heap
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare>
+void siftDown(Iterator first, IndexOf<Iterator> root, IndexOf<Iterator> heapSize, Compare comp)
+{
+    ValueOf<Iterator> element = std::move(first[root]); // Element being moved down
+
+    while ((2 * root) + 1 < heapSize)
+    {
+        IndexOf<Iterator> child = (2 * root) + 1; // Left child
+
+        if (child + 1 < heapSize && comp(first[child], first[child + 1]))
+        {
+            child++; // The right child is larger
+        }
+
+        if (!comp(element, first[child]))
+        {
+            break; // Both children are not greater -> Heap property restored
+        }
+
+        first[root] = std::move(first[child]); // Move the larger child up
+        root = child;
+    }
+
+    first[root] = std::move(element);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The heapSort() function sorts [first, last) in place in O(n*log(n)) time, the fallback of quickSort() once its recursion gets too deep.
+    >> Parameters:
+            Iterator first - Iterator to the first element to be sorted
+            Iterator last - Iterator past the last element to be sorted
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare>
+void heapSort(Iterator first, Iterator last, Compare comp)
+{
+    IndexOf<Iterator> heapSize = last - first;
+
+    for (IndexOf<Iterator> root = (heapSize / 2) - 1; root >= 0; root--) // Build the max-heap bottom-up
+    {
+        siftDown(first, root, heapSize, comp);
+    }
+
+    for (IndexOf<Iterator> end = heapSize - 1; end > 0; end--)
+    {
+        std::swap(first[0], first[end]); // The largest element is now in its sorted position
+        siftDown(first, IndexOf<Iterator>(0), end, comp);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sort3() function orders the three elements (a), (b) & (c) by comp.
+    >> Parameters:
+            Iterator a, b, c - Iterators to the elements to be ordered
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare>
+void sort3(Iterator a, Iterator b, Iterator c, Compare comp)
+{
+    if (comp(*b, *a))
+    {
+        std::swap(*a, *b);
+    }
+    if (comp(*c, *b))
+    {
+        std::swap(*b, *c);
+        if (comp(*b, *a))
+        {
+            std::swap(*a, *b);
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionFunction() function partitions [first, last) (at least 3 elements) around the median of its first, middle & last elements
+(Tukey's ninther of 9 evenly spaced elements above GENERIC_NINTHER_MIN elements, which also splits reversed & organ pipe inputs well),
+and returns the final position of the pivot: every element before it is not greater, every element after it is not less.
+    BranchlessSort types - Lomuto's scheme without a data-dependent branch (QuickSort-Lomuto's/quicksort.cpp's partitionBranchless()):
+                           the pivot is moved to the end, every element is swapped with [pivotIndex], and pivotIndex advances by the
+                           result of the comparison (0 or 1).
+    Other types - Hoare's scheme with the pivot moved to the front: two scans stop at elements not less / not greater than the pivot
+                  and swap them, so elements move only when they are on the wrong side (and copies of the pivot split evenly).
+    >> Parameters:
+            Iterator first - Iterator to the first element to be partitioned
+            Iterator last - Iterator past the last element to be partitioned
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+    >> Return:
+            Iterator - Position of the pivot
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare = std::less<>>
+Iterator partitionFunction(Iterator first, Iterator last, Compare comp = Compare())
+{
+    Iterator middle = first + (last - first) / 2;
+    if (last - first > GENERIC_NINTHER_MIN) // Tukey's ninther of 9 evenly spaced elements: the median of the medians of 3 groups
+    {
+        IndexOf<Iterator> step = (last - first) / 8;
+        middle = first + 4 * step;
+        sort3(first, first + step, first + 2 * step, comp);
+        sort3(first + 3 * step, middle, first + 5 * step, comp);
+        sort3(first + 6 * step, first + 7 * step, last - 1, comp);
+        sort3(first + step, middle, first + 7 * step, comp); // [first + step] <= [middle] <= [first + 7 * step]
+    }
+    else
+    {
+        sort3(first, middle, last - 1, comp); // [first] <= [middle] <= [last - 1]
+    }
+
+    if constexpr (BRANCHLESS<ValueOf<Iterator>>)
+    {
+        std::swap(*middle, *(last - 1)); // Pivot (the median) to the end
+        ValueOf<Iterator> pivot = *(last - 1);
+        Iterator pivotIndex = first; // [first] -> [pivotIndex - 1] are less than the pivot
+
+        for (Iterator i = first; i != last - 1; ++i)
+        {
+            ValueOf<Iterator> element = *i;
+            *i = *pivotIndex;
+            *pivotIndex = element;
+            pivotIndex += comp(element, pivot);
+        }
+
+        std::swap(*pivotIndex, *(last - 1)); // Pivot into its final position
+        return pivotIndex;
+    }
+    else
+    {
+        std::swap(*first, *middle); // Pivot (the median) to the front, [middle] <= pivot <= [last - 1] stop the scans
+        Iterator i = first;
+        Iterator j = last;
+
+        while (true)
+        {
+            do
+            {
+                ++i;
+            } while (comp(*i, *first));
+
+            do
+            {
+                --j;
+            } while (comp(*first, *j));
+
+            if (i >= j)
+            {
+                break;
+            }
+
+            std::swap(*i, *j);
+        }
+
+        std::swap(*first, *j); // Pivot into its final position
+        return j;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The skipEqual() function gathers the elements of [first, last) that are equal to the pivot (not less, not greater) at the front of the
+range without branching, and returns the end of the gathered run. quickSort() calls it on the right side of an unbalanced Lomuto
+partition, where the copies of the pivot end up (Lomuto's scheme sends them all to the right), so runs of equal values are finished in
+one pass instead of one level each.
+    >> Parameters:
+            Iterator first - Iterator to the first element right of the pivot
+            Iterator last - Iterator past the last element of the range
+            const ValueOf<Iterator> &pivot - The pivot of the partition
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+    >> Return:
+            Iterator - First element greater than the pivot, after the gathered copies
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare>
+Iterator skipEqual(Iterator first, Iterator last, const ValueOf<Iterator> &pivot, Compare comp)
+{
+    Iterator equalEnd = first; // [first] -> [equalEnd - 1] are equal to the pivot
+
+    for (Iterator i = first; i != last; ++i)
+    {
+        ValueOf<Iterator> element = *i;
+        *i = *equalEnd;
+        *equalEnd = element;
+        equalEnd += !comp(pivot, element); // Not less (right side) & not greater -> Equal
+    }
+
+    return equalEnd;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSort() function (recursive part) sorts [first, last) with IntroSort: partitionFunction() until (depth) levels have been used,
+heapSort() below that, and insertionSort() on ranges of GENERIC_INSERTION_CUTOFF or fewer elements. The smaller side is sorted
+recursively and the larger side by looping, so the recursion depth stays below log2(n).
+    >> Parameters:
+            Iterator first - Iterator to the first element to be sorted
+            Iterator last - Iterator past the last element to be sorted
+            int depth - Number of partitioning levels left before falling back to heapSort()
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare>
+void quickSort(Iterator first, Iterator last, int depth, Compare comp)
+{
+    while (last - first > GENERIC_INSERTION_CUTOFF)
+    {
+        if (depth-- == 0)
+        {
+            heapSort(first, last, comp);
+            return;
+        }
+
+        Iterator pivot = partitionFunction(first, last, comp);
+        Iterator rightFirst = pivot + 1;
+
+        if constexpr (BRANCHLESS<ValueOf<Iterator>>)
+        {
+            if (pivot - first < (last - first) / 8) // Unbalanced -> The right side may be full of copies of the pivot
+            {
+                rightFirst = skipEqual(rightFirst, last, *pivot, comp);
+            }
+        }
+
+        if (pivot - first < last - rightFirst) // Recurse on the smaller side, loop on the larger one
+        {
+            quickSort(first, pivot, depth, comp);
+            first = rightFirst;
+        }
+        else
+        {
+            quickSort(rightFirst, last, depth, comp);
+            last = pivot;
+        }
+    }
+
+    insertionSort(first, last, comp);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSort() function is the entry point of the generic IntroSort. It sets the depth limit to (2 * log2(n)) partitioning levels and
+sorts [first, last). The sort is unstable.
+    >> Parameters:
+            Iterator first - Iterator to the first element to be sorted
+            Iterator last - Iterator past the last element to be sorted
+            Compare comp - Strict weak ordering, comp(a, b) is true if (a) goes before (b), std::less<>() by default
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Iterator, typename Compare = std::less<>>
+void quickSort(Iterator first, Iterator last, Compare comp = Compare())
+{
+    int depth = 0; // 2 * floor(log2(n))
+    for (IndexOf<Iterator> size = last - first; size > 1; size /= 2)
+    {
+        depth += 2;
+    }
+
+    quickSort(first, last, depth, comp);
+}
+
+} // namespace generic
+
+#endif
@@ -18,6 +18,20 @@ building a sorted sub-array section within the unsorted array one element at a t
         our current element are shifted one position to the right in order to make space for our insertion. Once the correct position to
         insert our element is found, the element is inserted, and we then move to the next element to repeat this process until the
         entirety of the array is sorted (sub-array size = original array size).
+
+>> Binary InsertionSort: The sorted sub-array is sorted, so the insertion point of the next element can be found with a binary search
+        instead of a linear backward scan: log2(i) comparisons instead of up to (i). The search is branchless - each step halves the
+        search range & conditionally advances its base (compiled to a cmov), so the unpredictable comparisons cost no branch
+        mispredictions. Searching for the upper bound (the first element greater than (>) our element) inserts after any equal
+        elements, so the sort stays stable. The elements between the insertion point and our element are then shifted one position to
+        the right with a single memmove(), which copies them at memory bandwidth instead of one element per loop iteration. An element
+        that is not less than the last element of the sorted sub-array is already in place, and is skipped without a search.
+
+>> Guarded & Unguarded Kernels: Other sorts (QuickSort, MergeSort, IntroSort) finish their small sub-arrays with InsertionSort, so the
+        range kernels below sort a sub-array [low] -> [high]. The guarded kernel checks (index > low) on every shift, like
+        insertionSort(). The unguarded kernel drops that check: the caller guarantees that the element at [low - 1] is not greater than
+        any element of the sub-array (e.g. a QuickSort pivot to its left, or the minimum moved to the front), so the backward scan always
+        stops there. The binary kernel never scans past [low], so it needs no guard. All three have the InsertionKernel signature.
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Stable Algorithm: InsertionSort is a stable algorithm, meaning that elements with equal values will always retain their relative order
                      in the sorted array.
@@ -44,6 +58,17 @@ building a sorted sub-array section within the unsorted array one element at a t
                                    * (for-each)
                                   O(n) - Traversal of given array, n = # elements in array
                                    = O(n^2)
+
+        Binary InsertionSort: O(n^2) - The binary search needs O(log(n)) comparisons per element, so the comparisons drop to
+                                       O(n*log(n)), but the shifts still move O(n^2) elements in the worst & average case (memmove()
+                                       makes each shift fast, not shorter). Best-case O(n) - Sorted elements are skipped without a
+                                       search.
+                                          O(log(n)) - Binary search of the sorted sub-array, n = # elements in sub-array
+                                           + (plus)
+                                          O(n) - Shift of the sorted sub-array (one memmove()), n = # elements in sub-array
+                                           * (for-each)
+                                          O(n) - Traversal of given array, n = # elements in array
+                                           = O(n^2) moves, O(n*log(n)) comparisons
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Space Complexity:
         All-cases: O(1) - Each call of InsertionSort requires O(1) auxilliary space to traverse and sort the elements in the array.
@@ -107,13 +132,23 @@ building a sorted sub-array section within the unsorted array one element at a t
 >> Compile & Run:
         g++ insertionsort.cpp || g++ insertionsort.cpp -g -o insertionsort
         ./a.out || valgrind ./a.out || valgrind ./insertionsort || valgrind --leak-check=full ./insertionsort
+        ./a.out [engine] [dataFile]
+            engine = linear (default) | guarded | unguarded | binary | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 20000)
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
 
-#include <iostream> // cout
-#include <fstream>  // ifstream
-#include <sstream>  // stringstream
-#include <string>   // string
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <cstring>   // memmove
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort
 
 using namespace std;
 
@@ -148,6 +183,310 @@ void insertionSort(int dataArray[], int arraySize)
     }
 }
 
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The InsertionKernel type is an InsertionSort of the sub-array [low] -> [high], for use as the base case of other sorts.
+insertionSortGuarded(), insertionSortUnguarded() & binaryInsertionSort() all have this signature.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+typedef void (*InsertionKernel)(int dataArray[], int low, int high);
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSortGuarded() function is insertionSort() on the sub-array [low] -> [high]: the backward scan checks (index > low) before
+every comparison, so it never leaves the sub-array.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSortGuarded(int dataArray[], int low, int high)
+{
+    for (int i = low + 1; i <= high; i++)
+    {
+        int element = dataArray[i];
+        int index = i;
+
+        while ((index > low) && (dataArray[index - 1] > element)) // Guard: stop at the first element of the sub-array
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSortUnguarded() function is insertionSortGuarded() without the (index > low) check. The caller must guarantee that
+[low - 1] exists and holds an element that is not greater than any element of the sub-array: the backward scan stops there at the
+latest, so every shift costs one comparison instead of two.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted (low >= 1)
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSortUnguarded(int dataArray[], int low, int high)
+{
+    for (int i = low + 1; i <= high; i++)
+    {
+        int element = dataArray[i];
+        int index = i;
+
+        while (dataArray[index - 1] > element) // No guard: [low - 1] is a sentinel (<= element)
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The upperBound() function finds the first element of the sorted range [low] -> [high - 1] that is greater than (>) the given element,
+with a branchless binary search: each step compares the middle of the remaining range, and moves the base of the range by a conditional
+move instead of a branch.
+    >> Parameters:
+            const int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in the sorted range
+            int high - One past the index of the last element in the sorted range
+            int element - Element to be inserted
+    >> Return:
+            int - Index where the element is inserted (high if no element is greater)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int upperBound(const int dataArray[], int low, int high, int element)
+{
+    if (low >= high)
+    {
+        return low; // Empty range
+    }
+
+    const int *base = dataArray + low; // The insertion point is in [base] -> [base + length]
+    int length = high - low;
+
+    while (length > 1)
+    {
+        int half = length / 2;
+        base = (base[half] <= element) ? (base + half) : base; // Conditional move, no branch
+        length -= half;
+    }
+
+    return (int)(base - dataArray) + (*base <= element);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The binaryInsertionSort() function sorts the sub-array [low] -> [high] with binary insertion: the insertion point of each element is
+found in the sorted sub-array with upperBound(), and the elements from the insertion point up to the element are shifted one position
+to the right with a single memmove(). Elements that are already in place are skipped without a search.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void binaryInsertionSort(int dataArray[], int low, int high)
+{
+    for (int i = low + 1; i <= high; i++)
+    {
+        int element = dataArray[i];
+
+        if (dataArray[i - 1] <= element) // Already in place (sorted & nearly sorted input)
+        {
+            continue;
+        }
+
+        int position = upperBound(dataArray, low, i - 1, element); // [i - 1] is known to be greater than the element
+        memmove(&dataArray[position + 1], &dataArray[position], (size_t)(i - position) * sizeof(int)); // Shift the tail right by one
+        dataArray[position] = element;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the whole array with the named InsertionSort engine.
+    >> Parameters:
+            const string &engine - linear (insertionSort()) | guarded | unguarded | binary
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize)
+{
+    if (engine == "linear")
+    {
+        insertionSort(dataArray, arraySize);
+    }
+    else if (engine == "guarded")
+    {
+        insertionSortGuarded(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "unguarded")
+    {
+        int minimum = 0; // The whole array has no sentinel to its left, so the minimum is moved to [0] to become one
+        for (int i = 1; i < arraySize; i++)
+        {
+            minimum = (dataArray[i] < dataArray[minimum]) ? i : minimum;
+        }
+        if (arraySize > 0)
+        {
+            int temp = dataArray[0];
+            dataArray[0] = dataArray[minimum];
+            dataArray[minimum] = temp;
+        }
+        insertionSortUnguarded(dataArray, 1, (arraySize - 1));
+    }
+    else if (engine == "binary")
+    {
+        binaryInsertionSort(dataArray, 0, (arraySize - 1));
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The generateInput() function returns random integers generated from a fixed seed, so every run sorts the same data.
+    >> Parameters:
+            int arraySize - Number of integers to generate
+    >> Return:
+            vector<int> - The generated input
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+vector<int> generateInput(int arraySize)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+    vector<int> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        input[i] = distribution(generator);
+    }
+
+    return input;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the InsertionSort engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size());
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times every InsertionSort engine on the same random input, and checks every output against std::sort().
+It then times the range kernels as a base case: sorting a random array in independent blocks of 8 -> 64 elements, the way QuickSort &
+MergeSort use them on their small sub-arrays (each block is preceded by a sentinel for the unguarded kernel).
+    >> Parameters:
+            int arraySize - Number of integers to sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize)
+{
+    const char *engines[] = {"linear", "guarded", "unguarded", "binary"};
+
+    vector<int> input = generateInput(arraySize);
+    vector<int> expected = input;
+    sort(expected.begin(), expected.end()); // Reference output
+
+    cout << endl
+         << "Benchmark: " << arraySize << " random integers (ms)" << endl;
+
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with the reference output
+
+    for (const char *engine : engines)
+    {
+        double milliseconds = timeEngine(engine, input, output);
+        allMatch = allMatch && (output == expected);
+
+        cout << "   " << left << setw(12) << engine << right << setw(12) << fixed << setprecision(2) << milliseconds << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+
+    // Base-case kernels: blocks of (blockSize) elements, each preceded by the smallest int as the unguarded kernel's sentinel
+    const int totalElements = 1 << 20;
+    const int blockSizes[] = {8, 16, 32, 64};
+    const char *kernelNames[] = {"guarded", "unguarded", "binary"};
+    const InsertionKernel kernels[] = {insertionSortGuarded, insertionSortUnguarded, binaryInsertionSort};
+
+    cout << endl
+         << "Base-case kernels: " << totalElements << " random integers in blocks (ns per element)" << endl
+         << "   " << left << setw(12) << "kernel" << right;
+    for (int blockSize : blockSizes)
+    {
+        cout << setw(10) << "block=" << setw(2) << blockSize;
+    }
+    cout << endl;
+
+    input = generateInput(totalElements);
+    allMatch = true;
+    for (int k = 0; k < 3; k++)
+    {
+        cout << "   " << left << setw(12) << kernelNames[k] << right;
+
+        for (int blockSize : blockSizes)
+        {
+            int stride = blockSize + 1; // One sentinel slot in front of every block
+            int blocks = totalElements / blockSize;
+            vector<int> blocked((size_t)blocks * stride);
+            for (int b = 0; b < blocks; b++)
+            {
+                blocked[(size_t)b * stride] = -2147483647 - 1; // Sentinel (INT_MIN)
+                copy(input.begin() + (size_t)b * blockSize, input.begin() + (size_t)(b + 1) * blockSize,
+                     blocked.begin() + (size_t)b * stride + 1);
+            }
+
+            auto start = chrono::steady_clock::now();
+            for (int b = 0; b < blocks; b++)
+            {
+                kernels[k](blocked.data(), b * stride + 1, b * stride + blockSize);
+            }
+            auto stop = chrono::steady_clock::now();
+            double nanoseconds = chrono::duration<double, nano>(stop - start).count() / ((double)blocks * blockSize);
+
+            for (int b = 0; b < blocks; b++)
+            {
+                auto first = blocked.begin() + (size_t)b * stride;
+                allMatch = allMatch && is_sorted(first, first + stride);
+            }
+
+            cout << setw(12) << fixed << setprecision(2) << nanoseconds;
+        }
+        cout << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+}
+
 /*
 -----------------------------------------------------------------------------------------------------------------------------------------
 The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
@@ -196,12 +535,23 @@ void printArray(int dataArray[], int arraySize)
 main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
 # of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
 terminal before and after the InsertionSort algorithm is performed.
+    >> Arguments:
+            argv[1] - InsertionSort engine to run: linear (default) | guarded | unguarded | binary | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 20000)
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
-int main()
+int main(int argc, char *argv[])
 {
+    string engine = (argc > 1) ? argv[1] : "linear"; // InsertionSort engine selected on the command line
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 20000);
+        return 0;
+    }
+
     // Read the data from file
-    ifstream infile("data1.txt");
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
 
     if (!infile)
     {
@@ -245,9 +595,13 @@ int main()
     printArray(dataArray, arraySize);
 
     cout << endl
-         << "Running InsertionSort..." << endl;
-    // Call the insertionSort() function to sort the array
-    insertionSort(dataArray, arraySize);
+         << "Running InsertionSort (" << engine << ")..." << endl;
+    // Call the selected InsertionSort engine to sort the array
+    if (!sortWithEngine(engine, dataArray, arraySize))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
 
     // Print the sorted array
     cout << endl
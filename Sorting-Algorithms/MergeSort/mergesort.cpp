@@ -32,6 +32,67 @@ merge(), which takes a pair of adjacent sub-arrays on the same branch of the rec
         result, the untraversed element will always be greater than the last element in the temporary array. Through this process, the
         merged sequence of elements in the temporary array have been sorted into increasing (->) order, and the sub-array bounded by the
         [left] and [right] indices is overwritten by the corresponding values in the temporary array.
+
+>> Scratch Arena: The original Merge allocates (new[]) and frees (delete[]) its temporary array on every call, which results in roughly
+        (n) heap round-trips per sort. The arena variant allocates a single n-sized scratch buffer once before the recursion begins (or
+        borrows a buffer owned by the caller), and passes it down through every recursive call. Because only one Merge is ever active
+        at a time, every Merge can reuse the front of the same buffer, and no allocation occurs inside the hot merge loop. The arena
+        also records the largest number of scratch elements used by any single Merge (peak scratch usage), which is always (n).
+
+>> Bottom-Up MergeSort: An iterative engine that needs no call stack. Instead of recursively dividing the array, the first pass merges
+        adjacent runs of width 1 into sorted runs of width 2, the next pass merges runs of width 2 into runs of width 4, and so on until
+        a single run spans the whole array. Each pass reads from one buffer (source) and writes the merged runs into the other buffer
+        (destination), and the two buffers swap roles (ping-pong) before the next pass, so the copy-back loop at the end of Merge
+        disappears. When the number of passes is odd, the first pass is done in place (adjacent pairs are swapped when out of order),
+        so that the final pass always lands in the original array. Ties are always taken from the left run, so the result is exactly
+        the same stable ordering produced by the recursive MergeSort.
+
+>> Hybrid MergeSort: Most recursive calls of MergeSort (and most calls to Merge) work on sub-arrays of fewer than 16 elements, where the
+        call & merge overhead outweighs the actual sorting work. The hybrid engine stops dividing once a sub-array holds (cutoff) or
+        fewer elements, and sorts that leaf run in place with the InsertionSort kernel (see InsertionSort/insertionsort.cpp). Runs above
+        the cutoff are divided & merged exactly as before. InsertionSort only shifts elements that are strictly greater (>), so equal
+        elements keep their relative order and the hybrid engine stays stable. The cutoff is configurable (default 16). With
+        leaf=network, leaf runs of up to 32 elements are sorted by the branchless sorting network for their size instead (see
+        SortingNetworks/sortingnetworks.h), and larger runs still use InsertionSort. Networks are not stable, but equal integers are
+        indistinguishable, so the output is identical.
+
+>> Natural MergeSort: An adaptive engine (in the style of TimSort) for input that is already partly ordered. Instead of blindly dividing
+        the array in half, the array is scanned from left to right for natural runs: non-descending runs are kept as they are, and
+        strictly descending runs are reversed in place (strictly, so that reversing never reorders equal elements). Runs shorter than
+        (minRun) are extended with the InsertionSort kernel. Each run is pushed onto a run stack, and adjacent runs on the stack are
+        merged whenever the balance rules (len[X] > len[Y] + len[Z] & len[Y] > len[Z]) are broken, which keeps the merges balanced and
+        bounds the stack depth to O(log(n)). Before each merge, the elements of the left run that are already smaller than the whole
+        right run, and the elements of the right run that are already larger than the whole left run, are located by galloping
+        (exponential + binary search) and left untouched. Only the smaller of the two remaining runs is copied into scratch space. While
+        merging, once one run wins (MIN_GALLOP = 7) comparisons in a row, the merge switches to galloping mode and copies whole blocks at
+        a time. Ties are always taken from the left run, exactly like Merge. An already-sorted array is a single run, and finishes in
+        O(n) time with no merges at all.
+
+>> Parallel MergeSort: The two recursive calls of MergeSort work on independent halves of the array, so they can run at the same time.
+        The parallel engine turns the left recursive call into a task on a work-stealing thread pool, and keeps working on the right
+        half itself. Every thread owns a queue of tasks: it pushes & pops its own tasks at the back (newest first, which keeps the data
+        hot in its cache), and an idle thread steals the oldest task from the front of another thread's queue (the oldest task is the
+        largest piece of remaining work). A thread that waits for its left half to finish runs other pending tasks instead of
+        blocking. Sub-arrays of (grain) or fewer elements are sorted with the sequential hybrid engine. Each merge writes into its own
+        index range [left, right] of a shared scratch buffer, so concurrent merges never overlap, and the output is identical to the
+        sequential stable sort.
+
+>> Parallel Merge (Merge Path): Even when both halves are sorted in parallel, the final Merge of (n) elements would still run on a
+        single thread. The parallel merge splits the OUTPUT range into (p) equal segments instead. For the first output index (k) of
+        each segment, a binary search finds its co-ranks (i, j), with (i + j = k): the number of elements taken from the left & right
+        arrays before output position (k). These are the unique counts for which the last element taken from the left array is (<=)
+        the first element not taken from the right array, and the last element taken from the right array is (<) the first element
+        not taken from the left array (ties go to the left array, as in Merge). Every segment can then merge its own slices of both
+        arrays into its own slice of the output independently, and the result is identical to the stable sequential merge. The
+        parallel engine uses this for every merge above (grain) elements, and mergeSortedArrays() exposes it as a standalone "merge
+        two sorted arrays" function.
+
+>> SIMD Merge Kernels: The comparison (if dataArray[l] <= dataArray[r]) in the merge loop depends on the data, so on random input the
+        branch is mispredicted about half of the time. The merge kernels used by the bottom-up and parallel engines can avoid it: the
+        branchless kernel selects the smaller element with a conditional move and advances both inputs by the result of the comparison,
+        and the AVX2 (8 lanes) / AVX-512 (16 lanes) kernels merge whole registers with a bitonic merge network (min/max + shuffles, no
+        branches per element). The widest kernel supported by the CPU is chosen at runtime (kernel=auto), so the same binary runs on
+        any x86-64 CPU, and on other CPUs the branchless kernel is used. Every kernel writes byte-identical output.
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Stable Algorithm: MergeSort is a stable algorithm, meaning that elements with equal values will always retain their relative order in
                      the sorted array.
@@ -59,6 +120,18 @@ merge(), which takes a pair of adjacent sub-arrays on the same branch of the rec
                                      + (and)
                                     O(log(n)) - Recursive call frames added to the call stack, n = # of elements in array
                                      = O(n+log(n))
+
+        Scratch Arena: O(n+log(n)) - Identical bound, but the (n) auxilliary space is allocated exactly once per sort (or zero times
+                                     when the caller provides the buffer) instead of once per call to Merge.
+
+        Bottom-Up: O(n) - One (n) sized scratch buffer, and no recursive call frames.
+
+        Hybrid: O(n+log(n/cutoff)) - One (n) sized scratch buffer, and the recursion tree is (log(cutoff)) levels shorter.
+
+        Natural: O(n) - At most (n/2) scratch elements (only the smaller run of a merge is copied), and a fixed size run stack.
+                        Time is O(n) for already-sorted (or reverse-sorted) input, and O(n*log(r)) in general (r = # of natural runs).
+
+        Parallel: O(n+log(n)) - One (n) sized scratch buffer shared by all threads, plus one call stack per thread.
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Recursion Tree Diagram:
         Key: () = Maps to Execution Steps Below
@@ -172,15 +245,38 @@ merge(), which takes a pair of adjacent sub-arrays on the same branch of the rec
         * SORTED: arr[] = {8, 15, 16, 22, 30}
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Compile & Run:
-        g++ mergesort.cpp || g++ mergesort.cpp -g -o mergesort
+        g++ mergesort.cpp -pthread || g++ mergesort.cpp -pthread -g -o mergesort
         ./a.out || valgrind ./a.out || valgrind ./mergesort || valgrind --leak-check=full ./mergesort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = recursive (default) | arena | bottomup | hybrid | natural | parallel | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 1000000)
+            options = cutoff=16 (hybrid leaf run size)
+                      leaf=insertion (hybrid & parallel leaf kernel: insertion | network)
+                      threads=N (parallel thread count, default = # of cores)
+                      grain=16384 (parallel sequential fallback size)
+                      kernel=auto (bottomup & parallel merge kernel: auto | scalar | branchless | avx2 | avx512)
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
 
-#include <iostream> // cout
-#include <fstream>  // ifstream
-#include <sstream>  // stringstream
-#include <string>   // string
+#include <iostream>           // cout
+#include <fstream>            // ifstream
+#include <sstream>            // stringstream
+#include <string>             // string
+#include <cstdlib>            // atoi
+#include <vector>             // vector
+#include <random>             // mt19937, uniform_int_distribution
+#include <chrono>             // steady_clock
+#include <iomanip>            // setw, setprecision
+#include <algorithm>          // sort, reverse
+#include <thread>             // thread, hardware_concurrency
+#include <mutex>              // mutex, lock_guard
+#include <condition_variable> // condition_variable
+#include <atomic>             // atomic
+#include <deque>              // deque
+#include <functional>         // function
+#include <memory>             // unique_ptr
+
+#include "../SortingNetworks/sortingnetworks.h" // sortNetwork (leaf=network)
 
 using namespace std;
 
@@ -280,104 +376,2053 @@ void mergeSort(int dataArray[], int left, int right)
 
 /*
 -----------------------------------------------------------------------------------------------------------------------------------------
-The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
-format.
+The ScratchArena struct owns (or borrows) the single scratch buffer shared by every merge() call of one sort. The buffer is allocated
+once before the recursion begins, instead of once per merge() call, and is released when the arena goes out of scope.
+    >> Members:
+            int *buffer - Pointer to the scratch buffer used to store merged elements
+            int capacity - Number of integers the scratch buffer can hold
+            int peakUsage - Largest number of scratch elements used by a single merge() call
+            bool ownsBuffer - True if the arena allocated the buffer (and must free it), false if the caller owns it
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct ScratchArena
+{
+    int *buffer;
+    int capacity;
+    int peakUsage;
+    bool ownsBuffer;
+
+    // Allocate a scratch buffer of (capacity) integers, or borrow the caller's buffer if one is given
+    ScratchArena(int capacity, int callerBuffer[] = nullptr)
+        : buffer(callerBuffer), capacity(capacity), peakUsage(0), ownsBuffer(callerBuffer == nullptr)
+    {
+        if (ownsBuffer)
+        {
+            buffer = new int[(capacity > 0) ? capacity : 1]; // The only allocation made for the whole sort
+        }
+    }
+
+    ~ScratchArena()
+    {
+        if (ownsBuffer)
+        {
+            delete[] buffer; // Free dynamically allocated memory (*buffer array)
+        }
+    }
+
+    ScratchArena(const ScratchArena &) = delete;            // The arena is passed by reference, never copied
+    ScratchArena &operator=(const ScratchArena &) = delete; // (Copying would double-free the owned buffer)
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The merge() function (arena variant) merges the sorted sub-arrays bounded by the indices (left -> middle) & (middle + 1 -> right) exactly
+like merge() above, but stores the merged elements in the front of the arena's scratch buffer instead of a newly allocated array.
     >> Parameters:
-            int dataArray[] - Pointer to array of integers
-            int arraySize - Size of the array to be printed
+            int dataArray[] - Pointer to array of integers containing the sub-arrays to be merged
+            int left - Starting index of the left sub-array bounded by [left] & [middle]
+            int middle - Index where the array is divided (The ending index of the left sorted sub-array)
+            int right - Starting index of the right sub-array bounded by [middle] & [right]
+            ScratchArena &arena - Scratch buffer shared by every merge of the sort (must hold at least (right - left) + 1 elements)
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
-void printArray(int dataArray[], int arraySize)
+void merge(int dataArray[], int left, int middle, int right, ScratchArena &arena)
 {
-    for (int i = 0; i < arraySize; i++)
+    int l = left;       // Starting index for the left sub-array
+    int r = middle + 1; // Starting index for the right sub-array
+    int t = 0;          // Starting index for the scratch buffer
+
+    int size = (right - left) + 1; // Number of scratch elements needed by this merge
+    int *temp = arena.buffer;      // Reuse the front of the scratch buffer (No allocation)
+
+    if (size > arena.peakUsage)
     {
-        if ((i % 25) == 0) // New line every 25 elements printed
+        arena.peakUsage = size; // Record the largest scratch usage seen so far
+    }
+
+    // Merge the two sorted sub-arrays into the scratch buffer
+    while (l <= middle && r <= right) // While there are elements in both sub-arrays
+    {
+        if (dataArray[l] <= dataArray[r]) // Left element is smaller (or equal) -> Take it first to stay stable
         {
-            cout << endl
-                 << "   "; // Indent each new line
+            temp[t++] = dataArray[l++];
         }
-        if (i == (arraySize - 1)) // Last element
+        else // Right element is smaller
         {
-            if (dataArray[i] < 10) // If single-digit & last
-            {
-                cout << " " << dataArray[i] << endl; // Add extra space
-            }
-            else // Otherwise just print the element
-            {
-                cout << dataArray[i] << endl;
-            }
+            temp[t++] = dataArray[r++];
         }
-        else // Element is not last
+    }
+
+    while (l <= middle) // Copy the remaining left elements into the scratch buffer
+    {
+        temp[t++] = dataArray[l++];
+    }
+
+    while (r <= right) // Copy the remaining right elements into the scratch buffer
+    {
+        temp[t++] = dataArray[r++];
+    }
+
+    // Copy the merged sub-arrays back into the dataArray
+    for (int i = left; i <= right; i++)
+    {
+        dataArray[i] = temp[i - left]; // Overwrite the elements at index [i]
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSort() function (arena variant) recursively divides and merges the array exactly like mergeSort() above, passing the same
+scratch arena down through every recursive call so that no merge() call allocates memory.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Starting index of the sub-array to be sorted
+            int right - Ending index of the sub-array to be sorted
+            ScratchArena &arena - Scratch buffer shared by every merge of the sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeSort(int dataArray[], int left, int right, ScratchArena &arena)
+{
+    if (left < right) // If the dataArray segment has more than 1 element
+    {
+        int middle = left + (right - left) / 2;           // Calculate the middle index of the array
+        mergeSort(dataArray, left, middle, arena);        // Recursively divide & sort the left half of the array
+        mergeSort(dataArray, (middle + 1), right, arena); // Recursively divide & sort the right half of the array
+        merge(dataArray, left, middle, right, arena);     // Merge the two sorted halves using the shared scratch buffer
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortArena() function is the entry point of the arena variant. It allocates one n-sized scratch buffer up front (or borrows the
+caller's buffer), sorts the whole array, and reports the peak scratch usage.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int callerBuffer[] - Optional caller-owned scratch buffer of at least (arraySize) integers (nullptr = allocate one)
+    >> Return:
+            int peakUsage - Largest number of scratch elements used by a single merge
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int mergeSortArena(int dataArray[], int arraySize, int callerBuffer[] = nullptr)
+{
+    ScratchArena arena(arraySize, callerBuffer); // One allocation (or none) for the whole sort
+
+    mergeSort(dataArray, 0, (arraySize - 1), arena);
+
+    return arena.peakUsage;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+A MergeKernel merges two separate sorted arrays into an output array that does not overlap either input. Every kernel below produces
+exactly the same (byte-identical) output, and the fastest kernel supported by the CPU is chosen at runtime by selectMergeKernel().
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+typedef void (*MergeKernel)(const int first[], int firstSize, const int second[], int secondSize, int output[]);
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeArrays() function merges two separate sorted arrays into the output array (sequentially). Ties are taken from the first array to
+stay stable.
+    >> Parameters:
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+            int output[] - Pointer to the output array (must hold firstSize + secondSize elements)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeArrays(const int first[], int firstSize, const int second[], int secondSize, int output[])
+{
+    int f = 0; // Next element of the first array
+    int s = 0; // Next element of the second array
+    int t = 0; // Next position of the output array
+
+    while (f < firstSize && s < secondSize)
+    {
+        if (first[f] <= second[s]) // First element is smaller (or equal) -> Take it first to stay stable
         {
-            if (dataArray[i] < 10) // If single-digit & not last
-            {
-                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
-            }
-            else // Otherwise just add a trailing comma
-            {
-                cout << dataArray[i] << ", ";
-            }
+            output[t++] = first[f++];
+        }
+        else
+        {
+            output[t++] = second[s++];
         }
     }
+
+    while (f < firstSize)
+    {
+        output[t++] = first[f++];
+    }
+
+    while (s < secondSize)
+    {
+        output[t++] = second[s++];
+    }
 }
 
 /*
 -----------------------------------------------------------------------------------------------------------------------------------------
-main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
-# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
-terminal before and after the MergeSort algorithm is performed.
+The mergeArraysBranchless() function merges two separate sorted arrays exactly like mergeArrays(), but without a data-dependent branch in
+the merge loop. Both candidates are loaded, the smaller one is selected with a conditional move, and both input positions advance by
+the result of the comparison (0 or 1), so a random input no longer causes a branch misprediction on every other element.
+    >> Parameters:
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+            int output[] - Pointer to the output array (must hold firstSize + secondSize elements)
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
-int main()
+void mergeArraysBranchless(const int first[], int firstSize, const int second[], int secondSize, int output[])
 {
-    // Read the data from file
-    ifstream infile("data1.txt");
+    int f = 0; // Next element of the first array
+    int s = 0; // Next element of the second array
+    int t = 0; // Next position of the output array
 
-    if (!infile)
+    while (f < firstSize && s < secondSize)
     {
-        cerr << "ERROR - File Not Found" << endl;
-        return 1;
+        int firstElement = first[f];
+        int secondElement = second[s];
+        int takeFirst = (firstElement <= secondElement); // 1 if the first element goes next (Ties go first to stay stable)
+
+        output[t++] = takeFirst ? firstElement : secondElement; // Compiled to a conditional move, not a branch
+        f += takeFirst;
+        s += 1 - takeFirst;
     }
 
-    int arraySize = 0;        // Number of integers to be sorted (Size of array)
-    infile >> arraySize;      // Size is first line of data file
-    int dataArray[arraySize]; // To hold our data to be sorted
+    while (f < firstSize)
+    {
+        output[t++] = first[f++];
+    }
 
-    if (arraySize <= 0) // Check valid # of integers
+    while (s < secondSize)
     {
-        cerr << "ERROR - Invalid Number Of Integers" << endl;
-        return 1;
+        output[t++] = second[s++];
     }
+}
 
-    int index = 0; // Index to insert element into dataArray
-    string line;
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeTail() function finishes a vectorized merge. The (carry) register still holds (width) sorted elements that are larger than
+everything written so far, and at least one of the two inputs has fewer than (width) elements left. The carry is merged with that short
+remainder in a small buffer, and the buffer is then merged with the other remainder straight into the output.
+    >> Parameters:
+            const int carry[] - The (width) sorted elements left in the carry register
+            int width - Number of elements in the carry (8 or 16)
+            const int first[] - Pointer to the remainder of the first array
+            int firstSize - Number of elements left in the first array
+            const int second[] - Pointer to the remainder of the second array
+            int secondSize - Number of elements left in the second array
+            int output[] - Pointer to the next output position
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeTail(const int carry[], int width, const int first[], int firstSize, const int second[], int secondSize, int output[])
+{
+    int buffer[32]; // Carry (<= 16) + short remainder (< 16)
 
-    while (getline(infile, line)) // Get the next line of data after arraySize
+    if (firstSize < width) // The first array is the short remainder
     {
-        if (line == "")
+        mergeArraysBranchless(carry, width, first, firstSize, buffer);
+        mergeArraysBranchless(buffer, (width + firstSize), second, secondSize, output);
+    }
+    else // The second array is the short remainder
+    {
+        mergeArraysBranchless(carry, width, second, secondSize, buffer);
+        mergeArraysBranchless(first, firstSize, buffer, (width + secondSize), output);
+    }
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_MERGE_KERNELS 1
+#include <immintrin.h> // AVX2 / AVX-512 intrinsics (compiled per function with target attributes, no -mavx2 flag needed)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized" // False positive on the _mm512_undefined_*() placeholders inside immintrin.h
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The bitonicSort8() function sorts a bitonic sequence of 8 integers held in one AVX2 register, with the three half-cleaner stages of a
+bitonic merge network (compare-exchange at distance 4, 2, then 1). Each stage is one shuffle, one min, one max and one blend.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx2"))) static inline __m256i bitonicSort8(__m256i v)
+{
+    __m256i p = _mm256_permute2x128_si256(v, v, 0x01); // Distance 4 (swap 128-bit halves)
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xF0);
+
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)); // Distance 2
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xCC);
+
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)); // Distance 1
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xAA);
+
+    return v;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeArraysAvx2() function merges two separate sorted arrays 8 elements at a time with an AVX2 bitonic merge network. Two sorted
+registers are merged by reversing one of them (which makes their concatenation bitonic), taking the lane-wise min & max, and sorting both
+halves with bitonicSort8(): the low register then holds the 8 smallest elements, which are stored, and the high register is carried into
+the next step. The next 8-element block is loaded from whichever input has the smaller next element, which guarantees that the carried
+elements never need to be output before it. Since equal integers are indistinguishable, the output is byte-identical to mergeArrays().
+    >> Parameters:
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+            int output[] - Pointer to the output array (must hold firstSize + secondSize elements)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx2"))) void mergeArraysAvx2(const int first[], int firstSize, const int second[], int secondSize, int output[])
+{
+    if (firstSize < 8 || secondSize < 8)
+    {
+        mergeArraysBranchless(first, firstSize, second, secondSize, output);
+        return;
+    }
+
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    __m256i low = _mm256_loadu_si256((const __m256i *)first);   // Next block to be merged
+    __m256i high = _mm256_loadu_si256((const __m256i *)second); // Carried block (the 8 largest elements merged so far)
+    int f = 8;                                                  // Next element of the first array
+    int s = 8;                                                  // Next element of the second array
+    int t = 0;                                                  // Next position of the output array
+
+    while (true)
+    {
+        high = _mm256_permutevar8x32_epi32(high, reverse); // low + reversed(high) is a bitonic sequence of 16 elements
+        __m256i minimum = _mm256_min_epi32(low, high);     // 8 smallest elements (bitonic)
+        __m256i maximum = _mm256_max_epi32(low, high);     // 8 largest elements (bitonic)
+        low = bitonicSort8(minimum);
+        high = bitonicSort8(maximum);
+
+        _mm256_storeu_si256((__m256i *)(output + t), low);
+        t += 8;
+
+        if (f + 8 > firstSize || s + 8 > secondSize) // One input has less than a full block left
         {
-            continue; // Skip empty lines
+            break;
         }
 
-        stringstream ss(line); // To parse each line
-        int element;           // To store each integer delimited by a space " "
+        if (first[f] <= second[s]) // Load the next block from the input with the smaller next element
+        {
+            low = _mm256_loadu_si256((const __m256i *)(first + f));
+            f += 8;
+        }
+        else
+        {
+            low = _mm256_loadu_si256((const __m256i *)(second + s));
+            s += 8;
+        }
+    }
 
-        // While there is a next integer and there are more integers's to store
-        while ((ss >> element) && (index < arraySize))
+    int carry[8];
+    _mm256_storeu_si256((__m256i *)carry, high);
+    mergeTail(carry, 8, first + f, (firstSize - f), second + s, (secondSize - s), output + t);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The bitonicSort16() function sorts a bitonic sequence of 16 integers held in one AVX-512 register (compare-exchange at distance 8, 4, 2,
+then 1), like bitonicSort8().
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx512f"))) static inline __m512i bitonicSort16(__m512i v)
+{
+    __m512i p = _mm512_shuffle_i32x4(v, v, _MM_SHUFFLE(1, 0, 3, 2)); // Distance 8 (swap 256-bit halves)
+    v = _mm512_mask_blend_epi32(0xFF00, _mm512_min_epi32(v, p), _mm512_max_epi32(v, p));
+
+    p = _mm512_shuffle_i32x4(v, v, _MM_SHUFFLE(2, 3, 0, 1)); // Distance 4 (swap 128-bit lanes)
+    v = _mm512_mask_blend_epi32(0xF0F0, _mm512_min_epi32(v, p), _mm512_max_epi32(v, p));
+
+    p = _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)_MM_SHUFFLE(1, 0, 3, 2)); // Distance 2
+    v = _mm512_mask_blend_epi32(0xCCCC, _mm512_min_epi32(v, p), _mm512_max_epi32(v, p));
+
+    p = _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)_MM_SHUFFLE(2, 3, 0, 1)); // Distance 1
+    v = _mm512_mask_blend_epi32(0xAAAA, _mm512_min_epi32(v, p), _mm512_max_epi32(v, p));
+
+    return v;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeArraysAvx512() function merges two separate sorted arrays 16 elements at a time with an AVX-512 bitonic merge network, exactly
+like mergeArraysAvx2() with registers twice as wide.
+    >> Parameters:
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+            int output[] - Pointer to the output array (must hold firstSize + secondSize elements)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx512f"))) void mergeArraysAvx512(const int first[], int firstSize, const int second[], int secondSize,
+                                                          int output[])
+{
+    if (firstSize < 16 || secondSize < 16)
+    {
+        mergeArraysBranchless(first, firstSize, second, secondSize, output);
+        return;
+    }
+
+    const __m512i reverse = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    __m512i low = _mm512_loadu_si512((const void *)first);   // Next block to be merged
+    __m512i high = _mm512_loadu_si512((const void *)second); // Carried block (the 16 largest elements merged so far)
+    int f = 16;                                              // Next element of the first array
+    int s = 16;                                              // Next element of the second array
+    int t = 0;                                               // Next position of the output array
+
+    while (true)
+    {
+        high = _mm512_permutexvar_epi32(reverse, high); // low + reversed(high) is a bitonic sequence of 32 elements
+        __m512i minimum = _mm512_min_epi32(low, high);  // 16 smallest elements (bitonic)
+        __m512i maximum = _mm512_max_epi32(low, high);  // 16 largest elements (bitonic)
+        low = bitonicSort16(minimum);
+        high = bitonicSort16(maximum);
+
+        _mm512_storeu_si512((void *)(output + t), low);
+        t += 16;
+
+        if (f + 16 > firstSize || s + 16 > secondSize) // One input has less than a full block left
         {
-            dataArray[index++] = element; // Store the integer @ index, then increment the index
+            break;
+        }
+
+        if (first[f] <= second[s]) // Load the next block from the input with the smaller next element
+        {
+            low = _mm512_loadu_si512((const void *)(first + f));
+            f += 16;
+        }
+        else
+        {
+            low = _mm512_loadu_si512((const void *)(second + s));
+            s += 16;
         }
     }
 
-    // Print unsorted array
-    cout << endl
-         << "Array before sorting:";
-    printArray(dataArray, arraySize);
+    int carry[16];
+    _mm512_storeu_si512((void *)carry, high);
+    mergeTail(carry, 16, first + f, (firstSize - f), second + s, (secondSize - s), output + t);
+}
 
-    cout << endl
-         << "Running MergeSort..." << endl;
-    // Call the mergeSort() function to sort the array
-    mergeSort(dataArray, 0, (arraySize - 1));
+#pragma GCC diagnostic pop
+#endif
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The selectMergeKernel() function returns the merge kernel with the given name. "auto" picks the widest vector kernel the CPU supports at
+runtime (AVX-512, then AVX2), and falls back to the branchless scalar kernel.
+    >> Parameters:
+            const string &name - auto | scalar | branchless | avx2 | avx512
+    >> Return:
+            MergeKernel - The selected kernel, or nullptr if the name is unknown or the CPU does not support it
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+MergeKernel selectMergeKernel(const string &name)
+{
+    if (name == "scalar")
+    {
+        return mergeArrays;
+    }
+    if (name == "branchless")
+    {
+        return mergeArraysBranchless;
+    }
+
+#ifdef HAVE_X86_MERGE_KERNELS
+    __builtin_cpu_init();
+    bool hasAvx512 = __builtin_cpu_supports("avx512f");
+    bool hasAvx2 = __builtin_cpu_supports("avx2");
+
+    if (name == "avx512" || (name == "auto" && hasAvx512))
+    {
+        return hasAvx512 ? mergeArraysAvx512 : nullptr;
+    }
+    if (name == "avx2" || (name == "auto" && hasAvx2))
+    {
+        return hasAvx2 ? mergeArraysAvx2 : nullptr;
+    }
+#endif
+
+    return (name == "auto") ? mergeArraysBranchless : nullptr;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeRuns() function merges the sorted runs bounded by the indices (left -> middle) & (middle + 1 -> right) of the source array
+into the same index range of the destination array. Unlike merge(), nothing is copied back, so the caller decides which buffer holds
+the result.
+    >> Parameters:
+            const int source[] - Pointer to array of integers containing the runs to be merged
+            int destination[] - Pointer to array of integers that receives the merged run
+            int left - Starting index of the left run bounded by [left] & [middle]
+            int middle - Ending index of the left run
+            int right - Ending index of the right run bounded by [middle + 1] & [right]
+            MergeKernel kernel - Merge kernel doing the work (default mergeArrays)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeRuns(const int source[], int destination[], int left, int middle, int right, MergeKernel kernel = mergeArrays)
+{
+    kernel(source + left, (middle - left) + 1, source + middle + 1, (right - middle), destination + left);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortBottomUp() function sorts the array iteratively by merging runs of width 1, 2, 4, ... between the array and a scratch
+buffer, swapping the roles of the two buffers (ping-pong) after every pass instead of copying each merged run back.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int callerBuffer[] - Optional caller-owned scratch buffer of at least (arraySize) integers (nullptr = allocate one)
+            MergeKernel kernel - Merge kernel used by every pass (default mergeArrays)
+    >> Return:
+            int peakUsage - Number of scratch elements used by the sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int mergeSortBottomUp(int dataArray[], int arraySize, int callerBuffer[] = nullptr, MergeKernel kernel = mergeArrays)
+{
+    if (arraySize < 2)
+    {
+        return 0; // Already sorted, no scratch needed
+    }
+
+    ScratchArena arena(arraySize, callerBuffer); // One allocation (or none) for the whole sort
+    arena.peakUsage = arraySize;
+
+    int passes = 0; // Number of merge passes needed -> ceil(log2(arraySize))
+    for (int width = 1; width < arraySize; width *= 2)
+    {
+        passes++;
+    }
+
+    int width = 1; // Width of the sorted runs that are merged by the next pass
+
+    if ((passes % 2) == 1) // Odd number of passes -> Do the first pass in place so the last pass lands in dataArray
+    {
+        for (int i = 0; (i + 1) < arraySize; i += 2)
+        {
+            if (dataArray[i] > dataArray[i + 1]) // Only swap strictly out-of-order pairs to stay stable
+            {
+                int temp = dataArray[i];
+                dataArray[i] = dataArray[i + 1];
+                dataArray[i + 1] = temp;
+            }
+        }
+        width = 2;
+    }
+
+    int *source = dataArray;          // Buffer holding the sorted runs of the current width
+    int *destination = arena.buffer;  // Buffer receiving the merged runs of twice the width
+
+    for (; width < arraySize; width *= 2)
+    {
+        for (int left = 0; left < arraySize; left += 2 * width)
+        {
+            int middle = left + width - 1;     // Ending index of the left run
+            int right = left + (2 * width) - 1; // Ending index of the right run
+
+            if (right > (arraySize - 1))
+            {
+                right = arraySize - 1; // The last right run may be shorter than (width)
+            }
+
+            if (middle >= right) // Lone run at the end of the array -> Carry it over to the destination unchanged
+            {
+                for (int i = left; i <= right; i++)
+                {
+                    destination[i] = source[i];
+                }
+            }
+            else
+            {
+                mergeRuns(source, destination, left, middle, right, kernel);
+            }
+        }
+
+        int *temp = source; // Ping-pong: The destination of this pass is the source of the next pass
+        source = destination;
+        destination = temp;
+    }
+
+    return arena.peakUsage;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSort() function sorts the sub-array bounded by [left] & [right] in place. This is the InsertionSort kernel from
+InsertionSort/insertionsort.cpp, restricted to a range so that it can sort the leaf runs of the hybrid MergeSort.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Starting index of the sub-array to be sorted
+            int right - Ending index of the sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSort(int dataArray[], int left, int right)
+{
+    for (int i = left + 1; i <= right; i++)
+    {
+        int element = dataArray[i]; // Get the element stored at current index
+        int index = i;              // Set index = to the index of the selected element
+
+        // Shift every strictly greater (>) element of the sorted sub-array one position to the right (Keeps equal elements stable)
+        while ((index > left) && (dataArray[index - 1] > element))
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element; // Insert the element at its correct position within the sorted sub-array
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The LeafKernel type is a function that sorts the leaf run bounded by [left] & [right] in place. insertionSort() & networkSort() both
+have this signature, so the hybrid engine can use either of them.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+typedef void (*LeafKernel)(int dataArray[], int left, int right);
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The networkSort() function sorts the leaf run bounded by [left] & [right] with the sorting network for its size (sortNetwork() from
+SortingNetworks/sortingnetworks.h), or with insertionSort() if the run has more than MAX_NETWORK_SIZE (32) elements.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Starting index of the sub-array to be sorted
+            int right - Ending index of the sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void networkSort(int dataArray[], int left, int right)
+{
+    if (!sortNetwork(dataArray + left, (right - left) + 1))
+    {
+        insertionSort(dataArray, left, right); // Too large for a network
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The selectLeafKernel() function looks up a LeafKernel by name.
+    >> Parameters:
+            const string &name - insertion | network
+    >> Return:
+            LeafKernel - The leaf kernel, nullptr if the name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+LeafKernel selectLeafKernel(const string &name)
+{
+    if (name == "insertion")
+    {
+        return insertionSort;
+    }
+    if (name == "network")
+    {
+        return networkSort;
+    }
+
+    return nullptr;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSort() function (hybrid variant) recursively divides and merges the array like the arena variant, but sorts every sub-array of
+(cutoff) or fewer elements with insertionSort() (or the given leaf kernel) instead of dividing it further.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Starting index of the sub-array to be sorted
+            int right - Ending index of the sub-array to be sorted
+            ScratchArena &arena - Scratch buffer shared by every merge of the sort
+            int cutoff - Largest leaf run size sorted by the leaf kernel
+            LeafKernel leaf - Kernel that sorts the leaf runs (insertionSort() by default)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeSort(int dataArray[], int left, int right, ScratchArena &arena, int cutoff, LeafKernel leaf = insertionSort)
+{
+    if ((right - left) + 1 <= cutoff) // Leaf run -> Sort in place, no further division or merging
+    {
+        leaf(dataArray, left, right);
+        return;
+    }
+
+    int middle = left + (right - left) / 2;                         // Calculate the middle index of the array
+    mergeSort(dataArray, left, middle, arena, cutoff, leaf);        // Recursively divide & sort the left half of the array
+    mergeSort(dataArray, (middle + 1), right, arena, cutoff, leaf); // Recursively divide & sort the right half of the array
+    merge(dataArray, left, middle, right, arena);             // Merge the two sorted halves using the shared scratch buffer
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortHybrid() function is the entry point of the hybrid variant. It allocates one n-sized scratch buffer up front (or borrows
+the caller's buffer), and sorts the whole array with insertionSort() (or the given leaf kernel) leaf runs of at most (cutoff) elements.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int cutoff - Largest leaf run size sorted by the leaf kernel (values below 1 are treated as 1)
+            int callerBuffer[] - Optional caller-owned scratch buffer of at least (arraySize) integers (nullptr = allocate one)
+            LeafKernel leaf - Kernel that sorts the leaf runs (insertionSort() by default)
+    >> Return:
+            int peakUsage - Largest number of scratch elements used by a single merge
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int mergeSortHybrid(int dataArray[], int arraySize, int cutoff = 16, int callerBuffer[] = nullptr, LeafKernel leaf = insertionSort)
+{
+    if (arraySize < 2)
+    {
+        return 0; // Already sorted, no scratch needed
+    }
+
+    ScratchArena arena(arraySize, callerBuffer); // One allocation (or none) for the whole sort
+
+    mergeSort(dataArray, 0, (arraySize - 1), arena, (cutoff < 1) ? 1 : cutoff, leaf);
+
+    return arena.peakUsage;
+}
+
+const int MIN_GALLOP = 7;     // Number of consecutive wins by one run before a natural merge switches to galloping mode
+const int MAX_RUN_STACK = 85; // Run stack capacity of the natural engine (Enough for 2^64 elements under the balance rules)
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The gallopFromLeft() function counts the leading elements of a sorted run that come before the key, by galloping (probing offsets 1, 3,
+7, 15, ...) from the left end of the run and then binary searching the last gap.
+    >> Parameters:
+            int key - Element being located
+            const int run[] - Pointer to the sorted run
+            int length - Number of elements in the run
+            bool inclusive - True to count elements (<=) key, false to count elements (<) key
+    >> Return:
+            int - Number of leading elements of the run that come before the key
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int gallopFromLeft(int key, const int run[], int length, bool inclusive)
+{
+    int lastOffset = 0; // Every element before [lastOffset] comes before the key
+    int offset = 1;     // Next probe is at [offset - 1]
+
+    while (offset < length && (inclusive ? run[offset - 1] <= key : run[offset - 1] < key))
+    {
+        lastOffset = offset;
+        offset = (offset * 2) + 1;
+    }
+
+    int low = lastOffset;                         // Binary search the gap between the last two probes
+    int high = (offset < length) ? offset : length;
+
+    while (low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if (inclusive ? run[middle] <= key : run[middle] < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The gallopFromRight() function counts the leading elements of a sorted run that come before the key exactly like gallopFromLeft(), but
+gallops from the right end of the run. This is cheaper when the key is expected to land near the end of the run.
+    >> Parameters:
+            int key - Element being located
+            const int run[] - Pointer to the sorted run
+            int length - Number of elements in the run
+            bool inclusive - True to count elements (<=) key, false to count elements (<) key
+    >> Return:
+            int - Number of leading elements of the run that come before the key
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int gallopFromRight(int key, const int run[], int length, bool inclusive)
+{
+    int lastOffset = 0; // Every element from [length - lastOffset] onward does not come before the key
+    int offset = 1;     // Next probe is at [length - offset]
+
+    while (offset <= length && !(inclusive ? run[length - offset] <= key : run[length - offset] < key))
+    {
+        lastOffset = offset;
+        offset = (offset * 2) + 1;
+    }
+
+    int low = (offset <= length) ? (length - offset + 1) : 0; // Binary search the gap between the last two probes
+    int high = length - lastOffset;
+
+    while (low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if (inclusive ? run[middle] <= key : run[middle] < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeLow() function merges two adjacent sorted runs when the left run is the smaller one. The left run is copied into the scratch
+buffer, and the merge fills the array from the left. Once one run wins (MIN_GALLOP) comparisons in a row, whole blocks are located by
+galloping and copied at once. Ties are taken from the left run to stay stable.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers containing the runs to be merged
+            int baseA - Starting index of the left run
+            int lengthA - Number of elements in the left run
+            int baseB - Starting index of the right run (baseA + lengthA)
+            int lengthB - Number of elements in the right run
+            ScratchArena &arena - Scratch buffer (must hold at least lengthA elements)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeLow(int dataArray[], int baseA, int lengthA, int baseB, int lengthB, ScratchArena &arena)
+{
+    int *temp = arena.buffer;
+
+    if (lengthA > arena.peakUsage)
+    {
+        arena.peakUsage = lengthA; // Record the largest scratch usage seen so far
+    }
+
+    for (int i = 0; i < lengthA; i++)
+    {
+        temp[i] = dataArray[baseA + i]; // Copy the (smaller) left run into the scratch buffer
+    }
+
+    int a = 0;                    // Next element of the left run (in the scratch buffer)
+    int b = baseB;                // Next element of the right run (in place)
+    int endB = baseB + lengthB;   // One past the last element of the right run
+    int t = baseA;                // Next position to be filled in dataArray (always <= b)
+    int winsA = 0;                // Consecutive comparisons won by the left run
+    int winsB = 0;                // Consecutive comparisons won by the right run
+
+    while (a < lengthA && b < endB)
+    {
+        if (winsA >= MIN_GALLOP || winsB >= MIN_GALLOP) // Galloping mode -> Copy whole blocks at a time
+        {
+            int countA = gallopFromLeft(dataArray[b], temp + a, lengthA - a, true); // Left elements (<=) next right element
+            for (int i = 0; i < countA; i++)
+            {
+                dataArray[t++] = temp[a++];
+            }
+
+            if (a == lengthA)
+            {
+                break;
+            }
+
+            int countB = gallopFromLeft(temp[a], dataArray + b, endB - b, false); // Right elements (<) next left element
+            for (int i = 0; i < countB; i++)
+            {
+                dataArray[t++] = dataArray[b++];
+            }
+
+            if (countA < MIN_GALLOP && countB < MIN_GALLOP) // Galloping no longer pays off -> Back to one-at-a-time mode
+            {
+                winsA = 0;
+                winsB = 0;
+            }
+            continue;
+        }
+
+        if (temp[a] <= dataArray[b]) // Left element is smaller (or equal) -> Take it first to stay stable
+        {
+            dataArray[t++] = temp[a++];
+            winsA++;
+            winsB = 0;
+        }
+        else // Right element is smaller
+        {
+            dataArray[t++] = dataArray[b++];
+            winsB++;
+            winsA = 0;
+        }
+    }
+
+    while (a < lengthA) // Copy the remaining left elements (Remaining right elements are already in place)
+    {
+        dataArray[t++] = temp[a++];
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeHigh() function merges two adjacent sorted runs when the right run is the smaller one. The right run is copied into the scratch
+buffer, and the merge fills the array from the right. Galloping works like mergeLow(), mirrored. Ties are taken from the left run to
+stay stable (when filling from the right, equal right elements are placed first).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers containing the runs to be merged
+            int baseA - Starting index of the left run
+            int lengthA - Number of elements in the left run
+            int baseB - Starting index of the right run (baseA + lengthA)
+            int lengthB - Number of elements in the right run
+            ScratchArena &arena - Scratch buffer (must hold at least lengthB elements)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeHigh(int dataArray[], int baseA, int lengthA, int baseB, int lengthB, ScratchArena &arena)
+{
+    int *temp = arena.buffer;
+
+    if (lengthB > arena.peakUsage)
+    {
+        arena.peakUsage = lengthB; // Record the largest scratch usage seen so far
+    }
+
+    for (int i = 0; i < lengthB; i++)
+    {
+        temp[i] = dataArray[baseB + i]; // Copy the (smaller) right run into the scratch buffer
+    }
+
+    int a = baseA + lengthA - 1;   // Last unmerged element of the left run (in place)
+    int b = lengthB - 1;           // Last unmerged element of the right run (in the scratch buffer)
+    int t = baseB + lengthB - 1;   // Next position to be filled in dataArray (always >= a)
+    int winsA = 0;                 // Consecutive comparisons won by the left run
+    int winsB = 0;                 // Consecutive comparisons won by the right run
+
+    while (a >= baseA && b >= 0)
+    {
+        if (winsA >= MIN_GALLOP || winsB >= MIN_GALLOP) // Galloping mode -> Copy whole blocks at a time
+        {
+            // Right elements (>=) the last left element go to the end first
+            int countB = (b + 1) - gallopFromRight(dataArray[a], temp, (b + 1), false);
+            for (int i = 0; i < countB; i++)
+            {
+                dataArray[t--] = temp[b--];
+            }
+
+            if (b < 0)
+            {
+                break;
+            }
+
+            // Left elements (>) the last right element go to the end next
+            int countA = (a - baseA + 1) - gallopFromRight(temp[b], dataArray + baseA, (a - baseA + 1), true);
+            for (int i = 0; i < countA; i++)
+            {
+                dataArray[t--] = dataArray[a--];
+            }
+
+            if (countA < MIN_GALLOP && countB < MIN_GALLOP) // Galloping no longer pays off -> Back to one-at-a-time mode
+            {
+                winsA = 0;
+                winsB = 0;
+            }
+            continue;
+        }
+
+        if (dataArray[a] > temp[b]) // Left element is strictly larger -> It goes last
+        {
+            dataArray[t--] = dataArray[a--];
+            winsA++;
+            winsB = 0;
+        }
+        else // Right element is larger (or equal) -> It goes last to stay stable
+        {
+            dataArray[t--] = temp[b--];
+            winsB++;
+            winsA = 0;
+        }
+    }
+
+    while (b >= 0) // Copy the remaining right elements (Remaining left elements are already in place)
+    {
+        dataArray[t--] = temp[b--];
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The RunStack struct holds the natural runs that are waiting to be merged, from the oldest (bottom) to the most recent (top).
+    >> Members:
+            int base[] - Starting index of each run
+            int length[] - Number of elements in each run
+            int size - Number of runs on the stack
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct RunStack
+{
+    int base[MAX_RUN_STACK];
+    int length[MAX_RUN_STACK];
+    int size = 0;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeAt() function merges run [i] with run [i + 1] of the run stack. Elements that are already in their final position (the prefix
+of run [i] that is (<=) the first element of run [i + 1], and the suffix of run [i + 1] that is (>=) the last element of run [i]) are
+skipped by galloping, and the remaining elements are merged by mergeLow() or mergeHigh(), whichever copies fewer elements.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            RunStack &runs - Stack of pending runs
+            int i - Index of the left run on the stack (must be size - 2 or size - 3)
+            ScratchArena &arena - Scratch buffer
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeAt(int dataArray[], RunStack &runs, int i, ScratchArena &arena)
+{
+    int baseA = runs.base[i];
+    int lengthA = runs.length[i];
+    int baseB = runs.base[i + 1];
+    int lengthB = runs.length[i + 1];
+
+    runs.length[i] = lengthA + lengthB; // The merged run replaces run [i]
+    if (i == runs.size - 3)
+    {
+        runs.base[i + 1] = runs.base[i + 2]; // Slide the top run down into the freed slot
+        runs.length[i + 1] = runs.length[i + 2];
+    }
+    runs.size--;
+
+    int skipped = gallopFromLeft(dataArray[baseB], dataArray + baseA, lengthA, true); // Left prefix already in place
+    baseA += skipped;
+    lengthA -= skipped;
+
+    if (lengthA == 0)
+    {
+        return; // The runs were already in order
+    }
+
+    lengthB = gallopFromRight(dataArray[baseA + lengthA - 1], dataArray + baseB, lengthB, false); // Right suffix already in place
+
+    if (lengthB == 0)
+    {
+        return;
+    }
+
+    if (lengthA <= lengthB)
+    {
+        mergeLow(dataArray, baseA, lengthA, baseB, lengthB, arena);
+    }
+    else
+    {
+        mergeHigh(dataArray, baseA, lengthA, baseB, lengthB, arena);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeCollapse() function merges runs at the top of the run stack until the balance rules hold again for every run on the stack:
+    len[i - 2] > len[i - 1] + len[i] & len[i - 1] > len[i]
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            RunStack &runs - Stack of pending runs
+            ScratchArena &arena - Scratch buffer
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeCollapse(int dataArray[], RunStack &runs, ScratchArena &arena)
+{
+    while (runs.size > 1)
+    {
+        int n = runs.size - 2;
+
+        if ((n > 0 && runs.length[n - 1] <= runs.length[n] + runs.length[n + 1]) ||
+            (n > 1 && runs.length[n - 2] <= runs.length[n - 1] + runs.length[n]))
+        {
+            if (runs.length[n - 1] < runs.length[n + 1])
+            {
+                n--; // Merge the middle run with the smaller of its neighbours
+            }
+            mergeAt(dataArray, runs, n, arena);
+        }
+        else if (runs.length[n] <= runs.length[n + 1])
+        {
+            mergeAt(dataArray, runs, n, arena);
+        }
+        else
+        {
+            break; // The balance rules hold
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The countRun() function finds the natural run starting at index [start]. A non-descending run is returned as it is, and a strictly
+descending run is reversed in place (strictly descending, so that reversing never reorders equal elements).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int start - Starting index of the run
+            int arraySize - Size of the array
+    >> Return:
+            int - Number of elements in the (now non-descending) run
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int countRun(int dataArray[], int start, int arraySize)
+{
+    int end = start + 1; // One past the last element of the run
+
+    if (end == arraySize)
+    {
+        return 1;
+    }
+
+    if (dataArray[end] < dataArray[start]) // Strictly descending run
+    {
+        end++;
+        while (end < arraySize && dataArray[end] < dataArray[end - 1])
+        {
+            end++;
+        }
+
+        for (int low = start, high = end - 1; low < high; low++, high--) // Reverse the run in place
+        {
+            int temp = dataArray[low];
+            dataArray[low] = dataArray[high];
+            dataArray[high] = temp;
+        }
+    }
+    else // Non-descending run
+    {
+        end++;
+        while (end < arraySize && dataArray[end] >= dataArray[end - 1])
+        {
+            end++;
+        }
+    }
+
+    return end - start;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The computeMinRun() function returns the minimum run length used by the natural engine. Arrays shorter than 64 elements form a single
+run. Otherwise, the result lies in [32, 64] and is chosen so that (n / minRun) is a power of two (or slightly less than one), which keeps
+the final merges balanced.
+    >> Parameters:
+            int arraySize - Size of the array
+    >> Return:
+            int - Minimum run length
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int computeMinRun(int arraySize)
+{
+    int remainder = 0; // Becomes 1 if any bit shifted off is set
+
+    while (arraySize >= 64)
+    {
+        remainder |= (arraySize & 1);
+        arraySize >>= 1;
+    }
+
+    return arraySize + remainder;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortNatural() function is the entry point of the natural (adaptive) engine. It scans the array for natural runs, extends short
+runs to (minRun) elements with insertionSort(), and merges the runs on a balanced run stack with galloping merges.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int callerBuffer[] - Optional caller-owned scratch buffer of at least (arraySize / 2) integers (nullptr = allocate one)
+    >> Return:
+            int peakUsage - Largest number of scratch elements used by a single merge (0 if no merge was needed)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int mergeSortNatural(int dataArray[], int arraySize, int callerBuffer[] = nullptr)
+{
+    if (arraySize < 2)
+    {
+        return 0; // Already sorted, no scratch needed
+    }
+
+    ScratchArena arena((arraySize / 2), callerBuffer); // Only the smaller run of a merge is ever copied
+    RunStack runs;
+
+    int minRun = computeMinRun(arraySize);
+
+    for (int start = 0; start < arraySize;)
+    {
+        int length = countRun(dataArray, start, arraySize);
+
+        if (length < minRun) // Short run -> Extend it to (minRun) elements with the InsertionSort kernel
+        {
+            int forced = (arraySize - start < minRun) ? (arraySize - start) : minRun;
+            insertionSort(dataArray, start, (start + forced - 1));
+            length = forced;
+        }
+
+        runs.base[runs.size] = start; // Push the run, then restore the balance rules
+        runs.length[runs.size] = length;
+        runs.size++;
+        mergeCollapse(dataArray, runs, arena);
+
+        start += length;
+    }
+
+    while (runs.size > 1) // Merge all remaining runs, always merging the smaller neighbour first
+    {
+        int n = runs.size - 2;
+
+        if (n > 0 && runs.length[n - 1] < runs.length[n + 1])
+        {
+            n--;
+        }
+        mergeAt(dataArray, runs, n, arena);
+    }
+
+    return arena.peakUsage;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the tuning knobs of the sorting engines, which can be set on the command line as option=value.
+    >> Members:
+            int cutoff - Largest leaf run size sorted by insertionSort() in the hybrid (and parallel) engine
+            string leaf - Name of the leaf kernel used by the hybrid & parallel engines (see selectLeafKernel())
+            int threads - Number of threads used by the parallel engine (including the calling thread)
+            int grain - Largest sub-array sorted sequentially by the parallel engine
+            string kernel - Name of the merge kernel used by the bottom-up & parallel engines (see selectMergeKernel())
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    int cutoff = 16;
+    int threads = (thread::hardware_concurrency() > 0) ? (int)thread::hardware_concurrency() : 1;
+    int grain = 16384;
+    string kernel = "auto";
+    string leaf = "insertion";
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The WorkStealingPool class runs tasks on a fixed set of threads. Every thread owns a task queue: tasks spawned by a thread are pushed &
+popped at the back of its own queue, and a thread whose queue is empty steals from the front of another thread's queue. The thread that
+creates the pool takes part as thread [0], so a pool of (threadCount) threads starts (threadCount - 1) worker threads. Only one pool
+should be active at a time, since each thread remembers its queue index in a thread_local variable.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+class WorkStealingPool
+{
+public:
+    explicit WorkStealingPool(int threadCount)
+        : stopping(false), queuedTasks(0)
+    {
+        if (threadCount < 1)
+        {
+            threadCount = 1;
+        }
+
+        for (int i = 0; i < threadCount; i++)
+        {
+            queues.push_back(unique_ptr<TaskQueue>(new TaskQueue()));
+        }
+
+        currentQueue = 0; // The creating thread is thread [0]
+        for (int i = 1; i < threadCount; i++)
+        {
+            workers.push_back(thread(&WorkStealingPool::workerLoop, this, i));
+        }
+    }
+
+    ~WorkStealingPool()
+    {
+        {
+            lock_guard<mutex> guard(sleepLock);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    // Push a task onto the back of the calling thread's own queue, and wake up an idle thread to steal it
+    void submit(function<void()> task)
+    {
+        TaskQueue &queue = *queues[currentQueue];
+        {
+            lock_guard<mutex> guard(queue.lock);
+            queue.tasks.push_back(move(task));
+        }
+        queuedTasks++;
+
+        {
+            lock_guard<mutex> guard(sleepLock); // Pairs with the predicate check in workerLoop() (No lost wake-ups)
+        }
+        wakeUp.notify_one();
+    }
+
+    // Run one pending task (own queue first, then steal), returns false if every queue was empty
+    bool runPendingTask()
+    {
+        function<void()> task;
+
+        if (!takeTask(task))
+        {
+            return false;
+        }
+
+        task();
+        return true;
+    }
+
+private:
+    struct TaskQueue
+    {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<TaskQueue>> queues;
+    vector<thread> workers;
+    mutex sleepLock;              // Guards the sleep/wake-up handshake of idle workers
+    condition_variable wakeUp;    // Signalled when a task is submitted or the pool stops
+    bool stopping;                // True once the pool is being destroyed (guarded by sleepLock)
+    atomic<int> queuedTasks;      // Number of tasks sitting in the queues
+
+    static thread_local int currentQueue; // Queue index of the calling thread
+
+    // Pop the newest task of the calling thread's queue, or steal the oldest task of another queue
+    bool takeTask(function<void()> &task)
+    {
+        int queueCount = (int)queues.size();
+
+        for (int offset = 0; offset < queueCount; offset++)
+        {
+            int victim = (currentQueue + offset) % queueCount;
+            TaskQueue &queue = *queues[victim];
+            lock_guard<mutex> guard(queue.lock);
+
+            if (queue.tasks.empty())
+            {
+                continue;
+            }
+
+            if (offset == 0) // Own queue -> Newest task (LIFO)
+            {
+                task = move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else // Another thread's queue -> Steal the oldest task (FIFO)
+            {
+                task = move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+
+            queuedTasks--;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Worker threads run tasks until the pool stops, and sleep while every queue is empty
+    void workerLoop(int queueIndex)
+    {
+        currentQueue = queueIndex;
+
+        while (true)
+        {
+            if (runPendingTask())
+            {
+                continue;
+            }
+
+            unique_lock<mutex> guard(sleepLock);
+            wakeUp.wait(guard, [this]() { return stopping || queuedTasks.load() > 0; });
+
+            if (stopping)
+            {
+                return;
+            }
+        }
+    }
+};
+
+thread_local int WorkStealingPool::currentQueue = 0;
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The TaskGroup struct counts the spawned tasks that have not finished yet. A thread that waits on the group keeps running pending tasks of
+the pool (its own or stolen ones) instead of blocking, so a pool never deadlocks on nested fork/join.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct TaskGroup
+{
+    atomic<int> pending{0};
+
+    // Submit a task to the pool as part of this group
+    void spawn(WorkStealingPool &pool, function<void()> task)
+    {
+        pending++;
+        pool.submit([this, task]() {
+            task();
+            pending--;
+        });
+    }
+
+    // Help run pending tasks until every task of this group has finished
+    void wait(WorkStealingPool &pool)
+    {
+        while (pending.load() > 0)
+        {
+            if (!pool.runPendingTask())
+            {
+                this_thread::yield();
+            }
+        }
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The coRank() function finds how many elements of the first array come before output position (k) of the stable merge of two sorted
+arrays (the remaining (k - i) elements come from the second array). Binary search over the merge path diagonal (i + j = k).
+    >> Parameters:
+            int k - Output position (0 <= k <= firstSize + secondSize)
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+    >> Return:
+            int i - Number of elements of the first array among the first (k) output elements
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int coRank(int k, const int first[], int firstSize, const int second[], int secondSize)
+{
+    int low = (k - secondSize > 0) ? (k - secondSize) : 0; // At most (secondSize) elements can come from the second array
+    int high = (k < firstSize) ? k : firstSize;              // At most (firstSize) elements can come from the first array
+
+    while (low < high)
+    {
+        int i = low + (high - low) / 2; // Candidate count from the first array
+        int j = k - i;                  // Matching count from the second array (j >= 1 here)
+
+        if (first[i] <= second[j - 1]) // first[i] must precede second[j - 1] (Ties go to the first array) -> Take more from first
+        {
+            low = i + 1;
+        }
+        else
+        {
+            high = i;
+        }
+    }
+
+    return low;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parallelMerge() function merges two sorted arrays into the output array by splitting the output range into (segments) equal slices.
+The co-ranks of every slice boundary are found by coRank(), and each slice is merged by its own task on the pool.
+    >> Parameters:
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+            int output[] - Pointer to the output array (must hold firstSize + secondSize elements, and must not overlap the inputs)
+            WorkStealingPool &pool - Thread pool running the slice merges
+            int segments - Number of output slices (usually the thread count)
+            MergeKernel kernel - Merge kernel used for every slice (default mergeArrays)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void parallelMerge(const int first[], int firstSize, const int second[], int secondSize, int output[], WorkStealingPool &pool,
+                   int segments, MergeKernel kernel = mergeArrays)
+{
+    long long total = (long long)firstSize + secondSize;
+
+    if (segments < 2 || total < 2)
+    {
+        kernel(first, firstSize, second, secondSize, output);
+        return;
+    }
+
+    TaskGroup group;
+
+    for (int segment = 0; segment < segments; segment++)
+    {
+        int startK = (int)(total * segment / segments);     // First output position of this slice
+        int endK = (int)(total * (segment + 1) / segments); // One past the last output position of this slice
+
+        group.spawn(pool, [=]() {
+            int startI = coRank(startK, first, firstSize, second, secondSize);
+            int endI = coRank(endK, first, firstSize, second, secondSize);
+
+            kernel(first + startI, (endI - startI), second + (startK - startI), (endK - endI) - (startK - startI), output + startK);
+        });
+    }
+
+    group.wait(pool);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortedArrays() function is the standalone "merge two sorted arrays" entry point of the parallel merge. It starts a pool of
+(threads) threads and merges the two arrays with one output slice per thread.
+    >> Parameters:
+            const int first[] - Pointer to the first sorted array
+            int firstSize - Number of elements in the first array
+            const int second[] - Pointer to the second sorted array
+            int secondSize - Number of elements in the second array
+            int output[] - Pointer to the output array (must hold firstSize + secondSize elements, and must not overlap the inputs)
+            int threads - Number of threads (including the calling thread)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeSortedArrays(const int first[], int firstSize, const int second[], int secondSize, int output[], int threads)
+{
+    WorkStealingPool pool(threads);
+
+    parallelMerge(first, firstSize, second, secondSize, output, pool, threads);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortParallel() function (recursive part) sorts the sub-array bounded by [left] & [right]. The left half is spawned as a task on
+the work-stealing pool while the calling thread sorts the right half, and the two halves are merged (with parallelMerge()) once both
+are sorted. Sub-arrays of (grain) or fewer elements are sorted with the sequential hybrid engine.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Starting index of the sub-array to be sorted
+            int right - Ending index of the sub-array to be sorted
+            int scratch[] - Scratch buffer of the whole array (this call only uses scratch[left] -> scratch[right])
+            WorkStealingPool &pool - Thread pool running the spawned tasks
+            const EngineOptions &options - Grain size, leaf cutoff & merge kernel
+            MergeKernel kernel - Merge kernel used by the parallel merges
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void mergeSortParallel(int dataArray[], int left, int right, int scratch[], WorkStealingPool &pool, const EngineOptions &options,
+                       MergeKernel kernel)
+{
+    int size = (right - left) + 1;
+
+    if (size <= options.grain) // Small sub-array -> Sequential path, using this sub-array's own slice of the scratch buffer
+    {
+        ScratchArena arena(size, scratch + left);
+        mergeSort(dataArray, left, right, arena, (options.cutoff < 1) ? 1 : options.cutoff, selectLeafKernel(options.leaf));
+        return;
+    }
+
+    int middle = left + (right - left) / 2; // Calculate the middle index of the array
+
+    TaskGroup group;
+    group.spawn(pool, [=, &pool, &options]() { mergeSortParallel(dataArray, left, middle, scratch, pool, options, kernel); });
+    mergeSortParallel(dataArray, (middle + 1), right, scratch, pool, options, kernel); // Sort the right half on this thread
+    group.wait(pool);                                                                  // Wait for (or help with) the left half
+
+    // Merge both halves into this call's slice of the scratch buffer, one merge path slice per (grain) elements (up to # of threads)
+    int segments = (size / options.grain < options.threads) ? (size / options.grain) : options.threads;
+    segments = (segments < 1) ? 1 : segments; // At least one slice, or nothing would be copied back
+    parallelMerge(dataArray + left, (middle - left) + 1, dataArray + middle + 1, (right - middle), scratch + left, pool, segments,
+                  kernel);
+
+    // Copy the merged sub-array back into the dataArray (Each slice copied by its own task)
+    TaskGroup copyGroup;
+    for (int segment = 0; segment < segments; segment++)
+    {
+        int start = left + (int)((long long)size * segment / segments);
+        int end = left + (int)((long long)size * (segment + 1) / segments);
+
+        copyGroup.spawn(pool, [=]() {
+            for (int i = start; i < end; i++)
+            {
+                dataArray[i] = scratch[i];
+            }
+        });
+    }
+    copyGroup.wait(pool);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The mergeSortParallel() function is the entry point of the parallel engine. It allocates one n-sized scratch buffer, starts a
+work-stealing pool of (options.threads) threads, and sorts the whole array.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            const EngineOptions &options - Thread count, grain size, leaf cutoff & merge kernel
+    >> Return:
+            int peakUsage - Number of scratch elements used by the sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int mergeSortParallel(int dataArray[], int arraySize, const EngineOptions &options)
+{
+    if (arraySize < 2)
+    {
+        return 0; // Already sorted, no scratch needed
+    }
+
+    EngineOptions clamped = options; // At least one thread, and grains of at least one element (or the recursion never stops)
+    clamped.threads = (clamped.threads < 1) ? 1 : clamped.threads;
+    clamped.grain = (clamped.grain < 1) ? 1 : clamped.grain;
+
+    vector<int> scratch(arraySize); // One allocation for the whole sort, shared by all threads
+    WorkStealingPool pool(clamped.threads);
+
+    MergeKernel kernel = selectMergeKernel(clamped.kernel);
+    mergeSortParallel(dataArray, 0, (arraySize - 1), scratch.data(), pool, clamped, (kernel != nullptr) ? kernel : mergeArrays);
+
+    return arraySize;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the whole array with the named sorting engine, optionally printing engine statistics.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            const EngineOptions &options - Tuning knobs of the engines
+            bool verbose - True to print engine statistics (such as peak scratch usage)
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize, const EngineOptions &options, bool verbose)
+{
+    int peakUsage = -1; // Peak scratch usage reported by the engine (-1 = not reported)
+
+    if (engine == "recursive")
+    {
+        mergeSort(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "arena")
+    {
+        peakUsage = mergeSortArena(dataArray, arraySize);
+    }
+    else if (engine == "bottomup")
+    {
+        MergeKernel kernel = selectMergeKernel(options.kernel);
+        peakUsage = mergeSortBottomUp(dataArray, arraySize, nullptr, (kernel != nullptr) ? kernel : mergeArrays);
+    }
+    else if (engine == "hybrid")
+    {
+        peakUsage = mergeSortHybrid(dataArray, arraySize, options.cutoff, nullptr, selectLeafKernel(options.leaf));
+    }
+    else if (engine == "natural")
+    {
+        peakUsage = mergeSortNatural(dataArray, arraySize);
+    }
+    else if (engine == "parallel")
+    {
+        peakUsage = mergeSortParallel(dataArray, arraySize, options);
+    }
+    else
+    {
+        return false;
+    }
+
+    if (verbose && peakUsage >= 0)
+    {
+        cout << "Peak scratch usage: " << peakUsage << " elements (" << (peakUsage * sizeof(int)) << " bytes)" << endl;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Tuning knobs of the engines to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    int value = atoi(argument.c_str() + separator + 1);
+
+    if (name == "cutoff")
+    {
+        options.cutoff = value;
+    }
+    else if (name == "threads")
+    {
+        options.threads = value;
+    }
+    else if (name == "grain")
+    {
+        options.grain = value;
+    }
+    else if (name == "kernel" && selectMergeKernel(argument.substr(separator + 1)) != nullptr)
+    {
+        options.kernel = argument.substr(separator + 1);
+    }
+    else if (name == "leaf" && selectLeafKernel(argument.substr(separator + 1)) != nullptr)
+    {
+        options.leaf = argument.substr(separator + 1);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named sorting engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            const EngineOptions &options - Tuning knobs of the engines
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, const EngineOptions &options, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size(), options, false);
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The generateInput() function builds a benchmark input of the given shape from a fixed seed, so every run sorts the same data.
+    >> Parameters:
+            const string &pattern - random | sorted | reversed | shards (8 concatenated sorted shards) | appended (sorted + 1% random)
+            int arraySize - Number of integers to generate
+    >> Return:
+            vector<int> - The generated input
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+vector<int> generateInput(const string &pattern, int arraySize)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+    vector<int> input(arraySize);
+    for (int &element : input)
+    {
+        element = distribution(generator);
+    }
+
+    if (pattern == "sorted" || pattern == "reversed" || pattern == "appended")
+    {
+        int sortedLength = (pattern == "appended") ? (arraySize - arraySize / 100) : arraySize; // Random tail stays unsorted
+        sort(input.begin(), input.begin() + sortedLength);
+
+        if (pattern == "reversed")
+        {
+            reverse(input.begin(), input.end());
+        }
+    }
+    else if (pattern == "shards")
+    {
+        for (int shard = 0; shard < 8; shard++)
+        {
+            sort(input.begin() + (long long)arraySize * shard / 8, input.begin() + (long long)arraySize * (shard + 1) / 8);
+        }
+    }
+
+    return input;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times every sorting engine on the same generated inputs (random & partly ordered), and checks that each
+engine produces the same sorted output as the original recursive mergeSort(). The hybrid engine is also timed over a range of cutoffs.
+    >> Parameters:
+            int arraySize - Number of integers to sort
+            const EngineOptions &options - Tuning knobs of the engines
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize, const EngineOptions &options)
+{
+    const char *engines[] = {"recursive", "arena", "bottomup", "hybrid", "natural", "parallel"}; // The first is the reference
+    const char *patterns[] = {"random", "sorted", "reversed", "shards", "appended"};
+
+    cout << endl
+         << "Benchmark: " << arraySize << " integers (ms)" << endl
+         << "   " << left << setw(12) << "engine" << right;
+    for (const char *pattern : patterns)
+    {
+        cout << setw(12) << pattern;
+    }
+    cout << endl;
+
+    vector<vector<int>> inputs;
+    vector<vector<int>> expected;
+    for (const char *pattern : patterns)
+    {
+        inputs.push_back(generateInput(pattern, arraySize));
+        expected.push_back(vector<int>());
+    }
+
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with the reference output
+
+    for (const char *engine : engines)
+    {
+        cout << "   " << left << setw(12) << engine << right;
+
+        for (size_t p = 0; p < inputs.size(); p++)
+        {
+            double milliseconds = timeEngine(engine, inputs[p], options, output);
+
+            if (expected[p].empty())
+            {
+                expected[p] = output; // The first engine (recursive) is the reference output
+            }
+            allMatch = allMatch && (output == expected[p]);
+
+            cout << setw(12) << fixed << setprecision(2) << milliseconds;
+        }
+        cout << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+
+    cout << endl
+         << "Hybrid cutoff sweep (random):" << endl
+         << "   " << left << setw(14) << "" << right << setw(16) << "leaf=insertion" << setw(16) << "leaf=network" << endl;
+
+    for (int cutoff = 4; cutoff <= 128; cutoff *= 2)
+    {
+        EngineOptions sweepOptions = options;
+        sweepOptions.cutoff = cutoff;
+
+        sweepOptions.leaf = "insertion";
+        double insertionLeaf = timeEngine("hybrid", inputs[0], sweepOptions, output);
+        bool match = (output == expected[0]);
+
+        sweepOptions.leaf = "network"; // Runs above 32 elements fall back to insertionSort()
+        double networkLeaf = timeEngine("hybrid", inputs[0], sweepOptions, output);
+        match = match && (output == expected[0]);
+
+        cout << "   cutoff=" << left << setw(7) << cutoff << right << setw(13) << fixed << setprecision(2) << insertionLeaf << " ms"
+             << setw(13) << networkLeaf << " ms" << (match ? "   OK" : "   MISMATCH") << endl;
+    }
+
+    cout << endl
+         << "Parallel scaling (random, grain=" << options.grain << "):" << endl;
+
+    vector<int> threadCounts; // 1, 2, 4, ... up to (and including) options.threads
+    for (int threads = 1; threads < options.threads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back((options.threads > 1) ? options.threads : 1);
+
+    double oneThread = 0.0; // Time of the 1-thread run, the baseline of the speedup column
+
+    for (int threads : threadCounts)
+    {
+        EngineOptions scalingOptions = options;
+        scalingOptions.threads = threads;
+
+        double milliseconds = timeEngine("parallel", inputs[0], scalingOptions, output);
+        if (threads == 1)
+        {
+            oneThread = milliseconds;
+        }
+
+        cout << "   threads=" << left << setw(8) << threads << right << setw(10) << fixed << setprecision(2) << milliseconds << " ms"
+             << setw(8) << setprecision(2) << (oneThread / milliseconds) << "x" << ((output == expected[0]) ? "   OK" : "   MISMATCH")
+             << endl;
+    }
+
+    cout << endl
+         << "Parallel merge (merge path) of two sorted halves:" << endl;
+
+    int firstSize = arraySize / 2;
+    vector<int> first(inputs[0].begin(), inputs[0].begin() + firstSize);
+    vector<int> second(inputs[0].begin() + firstSize, inputs[0].end());
+    sort(first.begin(), first.end());
+    sort(second.begin(), second.end());
+
+    vector<int> merged(arraySize);
+    for (int threads : threadCounts)
+    {
+        auto start = chrono::steady_clock::now();
+        mergeSortedArrays(first.data(), firstSize, second.data(), (arraySize - firstSize), merged.data(), threads);
+        auto stop = chrono::steady_clock::now();
+
+        double milliseconds = chrono::duration<double, milli>(stop - start).count();
+        cout << "   threads=" << left << setw(8) << threads << right << setw(10) << fixed << setprecision(2) << milliseconds << " ms"
+             << ((merged == expected[0]) ? "   OK" : "   MISMATCH") << endl;
+    }
+
+    cout << endl
+         << "Merge kernel throughput (two sorted halves, bytes read + written):" << endl;
+
+    const char *kernels[] = {"scalar", "branchless", "avx2", "avx512"};
+    const int repeats = 10;
+
+    for (const char *name : kernels)
+    {
+        MergeKernel kernel = selectMergeKernel(name);
+        if (kernel == nullptr)
+        {
+            cout << "   " << left << setw(14) << name << right << "   not supported by this CPU" << endl;
+            continue;
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++)
+        {
+            kernel(first.data(), firstSize, second.data(), (arraySize - firstSize), merged.data());
+        }
+        auto stop = chrono::steady_clock::now();
+
+        double seconds = chrono::duration<double>(stop - start).count();
+        double gigabytes = (double)repeats * 2.0 * arraySize * sizeof(int) / 1e9;
+        cout << "   " << left << setw(14) << name << right << setw(10) << fixed << setprecision(2) << (gigabytes / seconds) << " GB/s"
+             << ((merged == expected[0]) ? "   OK" : "   MISMATCH") << endl;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
+terminal before and after the MergeSort algorithm is performed.
+    >> Arguments:
+            argv[1] - Sorting engine to run: recursive (default) | arena | bottomup | hybrid | natural | parallel | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 1000000)
+            argv[3...] - Engine options of the form option=value (cutoff=16, leaf=insertion, threads=N, grain=16384, kernel=auto)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "recursive"; // Sorting engine selected on the command line
+    EngineOptions options;                              // Tuning knobs selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000, options);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Running MergeSort (" << engine << ")..." << endl;
+    // Call the selected MergeSort engine to sort the array
+    if (!sortWithEngine(engine, dataArray, arraySize, options, true))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
 
     // Print the sorted array
     cout << endl
@@ -0,0 +1,629 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> QUICKSORT - DUAL-PIVOT PARTITIONING SCHEME (YAROSLAVSKIY'S) <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This quicksort.cpp file is a personal reference of the QuickSort algorithm implementing Yaroslavskiy's dual-pivot partitioning scheme
+(the scheme behind Java's Arrays.sort() for primitives). Instead of splitting the array around one pivot, dual-pivot QuickSort chooses
+two pivots (p <= q) and splits the array into three sub-arrays: elements less than (p), elements between (p) & (q), and elements greater
+than (q). The partitioning process is facilitated through the helper function partitionFunction(), and QuickSort then recursively sorts
+each of the three sub-arrays.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> QuickSort (Dual-Pivot Partitioning Scheme): Accepts a pointer to an array, along with the low & high indices of the sub-array to be
+        sorted. When the sub-array has more than one element, QuickSort calls the helper method PartitionFunction (Dual-Pivot) in order
+        to partition the array around two pivots. The two pivot indices returned by the partition function (leftPivot & rightPivot) bound
+        three sub-arrays: [low] -> [leftPivot - 1] holds the elements less than (p), [leftPivot + 1] -> [rightPivot - 1] the elements
+        between (p) & (q), and [rightPivot + 1] -> [high] the elements greater than (q). QuickSort recursively calls itself for all
+        three. When both pivots are equal, the middle sub-array only holds copies of the pivot and is already sorted, so it is skipped.
+
+>> PartitionFunction (Dual-Pivot Partitioning Scheme): The pivots are taken from [low] & [high] (swapped if needed so that p <= q). For
+        larger sub-arrays, the 2nd & 4th of 5 evenly spaced sample elements are moved there first, so that the three sub-arrays come out
+        close to n/3 each on sorted & patterned input. Three pointers traverse the sub-array: (less) marks the end of the "< p" region at
+        the left, (great) marks the start of the "> q" region at the right, and (k) scans the unknown elements in between. An element
+        less than (p) is swapped to [less], an element greater than (q) is swapped to [great] (after skipping the elements at the right
+        that are already greater than (q)), and anything else stays in the middle. Once (k) passes (great), the pivots are swapped into
+        their final positions at the ends of the middle region.
+
+>> Dual-Pivot vs Single-Pivot: Dual-pivot QuickSort does about as many comparisons as single-pivot QuickSort, but every partitioning
+        level splits the array in three instead of two. The recursion tree is only log3(n) levels deep instead of log2(n), so every
+        element is scanned by fewer partitioning passes (~1.6 * n * ln(n) element scans vs ~2 * n * ln(n)). As memory traffic (not
+        comparisons) dominates the running time of QuickSort on large arrays, the fewer passes are what the benchmark engine measures
+        against local copies of Hoare's & Lomuto's schemes (./a.out bench).
+
+>> Equal Pivot Values: When (p) & (q) are different but the middle region covers most of the sub-array (many copies of the pivots), the
+        copies of (p) & (q) are moved out of the middle region before it is sorted, so input with few distinct values does not degrade to
+        O(n^2).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Unstable Algorithm: QuickSort is an unstable algorithm, meaning that elements with equal values are not guaranteed to retain their
+                       relative order in the sorted array.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity (Dual-Pivot):
+        Worst-case: O(n^2) - Unbalanced partitions, where both pivots are the smallest/largest elements of each sub-array, and each
+                             partitioning level only removes the two pivots. The recursion tree has a depth of (n/2) levels, and each
+                             level performs (n) work to partition the sub-array.
+                                O(n) - Level of recursion tree, n = # of elements in partition (sub-array)
+                                 * (for-each)
+                                O(n) - Depth (levels) of recursion tree, n = # of elements in array
+                                 = O(n^2)
+
+        Best-case: O(n*log(n)) - Balanced partitions, where each sub-array is partitioned into three nearly equal pieces of size ~(n/3).
+                                 Recursion tree has a depth of log3(n) levels before reaching base case of an array of size (1). Each
+                                 level of the recursion tree performs (n) work to partition the sub-arrays.
+                                    O(n) - Level of recursion tree, n = # of elements in partition (sub-array)
+                                     * (for-each)
+                                    O(log(n)) - Depth (levels) of recursion tree, n = # of elements in array
+                                     = O(n*log(n))
+
+        Average-case: O(n*log(n)) - Reasonably balanced partitions, where each sub-array is partitioned into three roughly equal pieces
+                                    ~(n/3). Recursion tree has a depth of log3(n) levels before reaching base case of an array of size
+                                    (1). Each level of the recursion tree performs (n) work to partition the sub-arrays.
+                                       O(n) - Level of recursion tree, n = # of elements in partition (sub-array)
+                                        * (for-each)
+                                       O(log(n)) - Depth (levels) of recursion tree, n = # of elements in array
+                                        = O(n*log(n))
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity (Dual-Pivot):
+        Worst-case: O(n) - Unbalanced partitions, (n/2) recursive call frames added to the call stack before array of size (1).
+                              O(1) - Temporary variables for each recursive call, 1 = constant space
+                               * (for-each)
+                              O(n) - Recursive call frames added to the call stack, n = # of elements in array
+                               = O(n)
+
+        Best-case: O(log(n)) - Balanced partitions, log3(n) recursive call frames added to the call stack before array of size (1).
+                                  O(1) - Temporary variables for each recursive call, 1 = constant space
+                                   * (for-each)
+                                  O(log(n)) - Recursive call frames added to the call stack, n = # of elements in array
+                                   = O(log(n))
+
+        Average-case: O(log(n)) - Reasonably balanced partitions, log3(n) recursive call frames added to the call stack before array of
+                                  size (1).
+                                     O(1) - Temporary variables for each recursive call, 1 = constant space
+                                      * (for-each)
+                                     O(log(n)) - Recursive call frames added to the call stack, n = # of elements in array
+                                      = O(log(n))
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Recursion Tree Diagram (Dual-Pivot):
+        Key: () = Maps to Execution Steps Below, ❰❱ = Pivot Elements
+             {} = Before partitionFunction(), [] = After partitionFunction()
+        Array = {22, 8, 15, 30, 16};
+
+        * DIVIDE:   (1) {❰22❱, 8, 15, 30, ❰16❱}
+                        [15, 8, ❰16❱, ❰22❱, 30]---------------------------|
+                         |                     |                          |
+                    (2) {❰15❱, ❰8❱}        (6) {X}                   (7) {30}
+                        [❰8❱, ❰15❱]-----------|
+                         |         |          |
+                    (3) {X}   (4) {X}    (5) {X}
+
+        * CONQUER:  Through the helper function partitionFunction(), the sorted property of the array emerges once the base case is
+                    reached for each branch of the recursion tree.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example Partition (Dual-Pivot):
+        Key: {} = Array, ❰❱ = Pivot Elements, (+) = Swap
+        Array = {22, 8, 15, 30, 16};
+
+            (1) First-Step: quickSort(arr[], 0, 4) {}
+                   ⮕ A call to partitionFunction(arr[], 0, 4) is made
+                      Pivots are the first & last elements ❰22❱ & ❰16❱, ❰22❱ > ❰16❱
+                   (+) [22] & [16] are swapped -> p = ❰16❱, q = ❰22❱ -> [❰16❱, 8, 15, 30, ❰22❱]
+                      Pointers Initialized -> (less) = 1, (k) = 1, (great) = 3
+                       (k) = 1 -> [8] is less than ❰16❱, swapped to [less] (itself), (less) = 2
+                       (k) = 2 -> [15] is less than ❰16❱, swapped to [less] (itself), (less) = 3
+                       (k) = 3 -> [30] is greater than ❰22❱, swapped to [great] (itself), (great) = 2
+                       (k) = 4 -> (k) has moved past (great), Stop here
+                   (+) p is swapped into [less - 1] = [2] -> [15, 8, ❰16❱, 30, ❰22❱]
+                   (+) q is swapped into [great + 1] = [3] -> [15, 8, ❰16❱, ❰22❱, 30]
+                   ⮕ Return: leftPivot = 2, rightPivot = 3
+                   ⮕ Sub-arrays: [15, 8] < ❰16❱ <= [] <= ❰22❱ < [30]
+
+        * SORTED: arr[] = {8, 15, 16, 22, 30}
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Note: The single-pivot partitioning schemes used for comparison (quickSortHoare() & quickSortLomuto()) are local copies of the
+         partitionFunction() & quickSort() functions of QuickSort-Hoare's/quicksort.cpp & QuickSort-Lomuto's/quicksort.cpp, so that all
+         three schemes can be timed on exactly the same input by a single program.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ quicksort.cpp || g++ quicksort.cpp -g -o quicksort
+        ./a.out || valgrind ./a.out || valgrind ./quicksort || valgrind --leak-check=full ./quicksort
+        ./a.out [engine] [dataFile]
+            engine = recursive (default, dual-pivot) | hoare | lomuto | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 1000000)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort, swap
+
+using namespace std;
+
+const int PIVOT_SAMPLE_MIN = 32; // Sub-arrays of at least this size take their pivots from 5 sample elements
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The choosePivots() function moves the 2nd & 4th smallest of 5 evenly spaced sample elements (the tertiles of the sample) to [low] &
+[high], where partitionFunction() takes its pivots from.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void choosePivots(int dataArray[], int low, int high)
+{
+    int sixth = ((high - low) + 1) / 6;
+    int sample[5] = {low + sixth, low + 2 * sixth, low + 3 * sixth, low + 4 * sixth, low + 5 * sixth}; // Indices of the sample
+
+    for (int i = 1; i < 5; i++) // InsertionSort the 5 sample elements in place (at their own indices)
+    {
+        for (int j = i; j > 0 && dataArray[sample[j]] < dataArray[sample[j - 1]]; j--)
+        {
+            swap(dataArray[sample[j]], dataArray[sample[j - 1]]);
+        }
+    }
+
+    swap(dataArray[low], dataArray[sample[1]]);  // p = 2nd of 5
+    swap(dataArray[high], dataArray[sample[3]]); // q = 4th of 5
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionFunction() partitions the dataArray segment using Yaroslavskiy's dual-pivot partitioning scheme. All elements less than
+the left pivot (p) are moved to its left, all elements greater than the right pivot (q) are moved to its right, and the elements in
+between (p <= x <= q) end up between the two pivots.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int &leftPivot - Receives the final index of the left pivot (p)
+            int &rightPivot - Receives the final index of the right pivot (q)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void partitionFunction(int dataArray[], int low, int high, int &leftPivot, int &rightPivot)
+{
+    if ((high - low) + 1 >= PIVOT_SAMPLE_MIN)
+    {
+        choosePivots(dataArray, low, high);
+    }
+
+    if (dataArray[low] > dataArray[high]) // Make sure p <= q
+    {
+        swap(dataArray[low], dataArray[high]);
+    }
+
+    int p = dataArray[low];  // Left pivot
+    int q = dataArray[high]; // Right pivot
+
+    int less = low + 1;   // [low + 1] -> [less - 1] are < p
+    int great = high - 1; // [great + 1] -> [high - 1] are > q
+    int k = low + 1;      // [less] -> [k - 1] are between p & q, [k] -> [great] are unknown
+
+    while (k <= great)
+    {
+        if (dataArray[k] < p) // Less than the left pivot -> Swap to the left region
+        {
+            swap(dataArray[k], dataArray[less]);
+            less++;
+        }
+        else if (dataArray[k] > q) // Greater than the right pivot -> Swap to the right region
+        {
+            while (dataArray[great] > q && k < great) // Skip the elements at the right that are already in place
+            {
+                great--;
+            }
+            swap(dataArray[k], dataArray[great]);
+            great--;
+
+            if (dataArray[k] < p) // The element swapped in from the right may belong to the left region
+            {
+                swap(dataArray[k], dataArray[less]);
+                less++;
+            }
+        }
+
+        k++; // [k] Moves toward higher index [->]
+    }
+
+    less--;
+    great++;
+    swap(dataArray[low], dataArray[less]);   // Left pivot into its final position
+    swap(dataArray[high], dataArray[great]); // Right pivot into its final position
+
+    leftPivot = less;
+    rightPivot = great;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSort() function recursively sorts the segment of the array between the low & high indices. Uses a helper function
+"partitionFunction()" which implements Yaroslavskiy's dual-pivot partitioning scheme.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSort(int dataArray[], int low, int high)
+{
+    // Base-case: low = high (sub-array of size 1)
+    // Recursive-case: low < high (sub-array of size 2 or more)
+    // Error Condition: low > high
+
+    if (low < high) // If the dataArray segment has more than 1 element
+    {
+        int leftPivot = 0;
+        int rightPivot = 0;
+        partitionFunction(dataArray, low, high, leftPivot, rightPivot); // Get the final indices of both pivots
+
+        int p = dataArray[leftPivot];
+        int q = dataArray[rightPivot];
+        int middleLow = leftPivot + 1;   // First element of the middle sub-array
+        int middleHigh = rightPivot - 1; // Last element of the middle sub-array
+
+        // Middle sub-array covers most of the segment -> Move the copies of p & q out of it (few distinct values)
+        if (p < q && (middleHigh - middleLow) + 1 > ((high - low) + 1) / 2)
+        {
+            for (int k = middleLow; k <= middleHigh; k++)
+            {
+                if (dataArray[k] == p) // Copy of p -> Swap to the left end of the middle sub-array
+                {
+                    swap(dataArray[k], dataArray[middleLow]);
+                    middleLow++;
+                }
+                else if (dataArray[k] == q) // Copy of q -> Swap to the right end of the middle sub-array
+                {
+                    swap(dataArray[k], dataArray[middleHigh]);
+                    middleHigh--;
+                    k--; // Re-check the element swapped in from the right
+                }
+            }
+        }
+
+        quickSort(dataArray, low, (leftPivot - 1)); // Recursive call for left partition (< p)
+        if (p < q)                                   // p = q -> The middle partition holds only copies of the pivot
+        {
+            quickSort(dataArray, middleLow, middleHigh); // Recursive call for middle partition (p < x < q)
+        }
+        quickSort(dataArray, (rightPivot + 1), high); // Recursive call for right partition (> q)
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionHoare() function is a local copy of partitionFunction() from QuickSort-Hoare's/quicksort.cpp (pivot = middle element),
+used by the benchmark.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+    >> Return:
+            int j - Index of the partition boundary
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int partitionHoare(int dataArray[], int low, int high)
+{
+    int pivot = dataArray[low + (high - low) / 2]; // Middle element
+    int i = (low - 1);
+    int j = (high + 1);
+
+    while (true)
+    {
+        do
+        {
+            i++;
+        } while (dataArray[i] < pivot);
+
+        do
+        {
+            j--;
+        } while (dataArray[j] > pivot);
+
+        if (i >= j)
+        {
+            return j;
+        }
+
+        swap(dataArray[i], dataArray[j]);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortHoare() function is a local copy of quickSort() from QuickSort-Hoare's/quicksort.cpp, used by the benchmark.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSortHoare(int dataArray[], int low, int high)
+{
+    if (low < high)
+    {
+        int pivotIndex = partitionHoare(dataArray, low, high);
+
+        quickSortHoare(dataArray, low, pivotIndex);
+        quickSortHoare(dataArray, (pivotIndex + 1), high);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionLomuto() function is a local copy of partitionFunction() from QuickSort-Lomuto's/quicksort.cpp (pivot = last element),
+used by the benchmark.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+    >> Return:
+            int pivotIndex - Index of the pivot element's new position
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int partitionLomuto(int dataArray[], int low, int high)
+{
+    int pivot = dataArray[high]; // Last element
+    int pivotIndex = low;
+
+    for (int i = low; i < high; i++)
+    {
+        if (dataArray[i] < pivot)
+        {
+            swap(dataArray[i], dataArray[pivotIndex]);
+            pivotIndex++;
+        }
+    }
+
+    swap(dataArray[high], dataArray[pivotIndex]);
+    return pivotIndex;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortLomuto() function is a local copy of quickSort() from QuickSort-Lomuto's/quicksort.cpp, used by the benchmark.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSortLomuto(int dataArray[], int low, int high)
+{
+    if (low < high)
+    {
+        int pivotIndex = partitionLomuto(dataArray, low, high);
+
+        quickSortLomuto(dataArray, low, (pivotIndex - 1));
+        quickSortLomuto(dataArray, (pivotIndex + 1), high);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the whole array with the named partitioning scheme.
+    >> Parameters:
+            const string &engine - recursive (dual-pivot) | hoare | lomuto
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize)
+{
+    if (engine == "recursive")
+    {
+        quickSort(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "hoare")
+    {
+        quickSortHoare(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "lomuto")
+    {
+        quickSortLomuto(dataArray, 0, (arraySize - 1));
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named sorting engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size());
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times the dual-pivot, Hoare's & Lomuto's schemes on the same random input (generated from a fixed seed), and
+checks every output against std::sort().
+    >> Parameters:
+            int arraySize - Number of integers to sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize)
+{
+    const char *engines[] = {"recursive", "hoare", "lomuto"};
+
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+    vector<int> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        input[i] = distribution(generator);
+    }
+
+    vector<int> expected = input;
+    sort(expected.begin(), expected.end()); // Reference output
+
+    cout << endl
+         << "Benchmark: " << arraySize << " random integers (ms)" << endl;
+
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with the reference output
+
+    for (const char *engine : engines)
+    {
+        double milliseconds = timeEngine(engine, input, output);
+        allMatch = allMatch && (output == expected);
+
+        cout << "   " << left << setw(12) << engine << right << setw(12) << fixed << setprecision(2) << milliseconds << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
+terminal before and after the QuickSort algorithm is performed.
+    >> Arguments:
+            argv[1] - Sorting engine to run: recursive (default, dual-pivot) | hoare | lomuto | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 1000000)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "recursive"; // Sorting engine selected on the command line
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Running QuickSort - Dual-Pivot Partitioning Scheme (" << engine << ")..." << endl;
+    // Call the selected QuickSort engine to sort the array
+    if (!sortWithEngine(engine, dataArray, arraySize))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    // Print the sorted array
+    cout << endl
+         << "Array after sorting:";
+    printArray(dataArray, arraySize);
+    cout << endl;
+
+    return 0;
+}
@@ -32,6 +32,67 @@ elements into sorted order and establishes new partition boundaries.
         occurs, the element pointed at by [i] is swapped with the element stored at the [pivotIndex] counter, and the pivotIndex is
         incremented by one. Once the sub-array has been traversed by pointer (i), the pivot element is swapped with the element stored at
         the [pivotIndex] counter. This places the pivot in its correct position, where: {left elements} < pivot < {right elements}.
+
+>> Bounded Stack QuickSort: quickSort() recurses into both partitions, so unbalanced partitions put O(n) frames on the call stack, which
+        overflows small (e.g. worker thread) stacks long before the sort would finish. quickSortBounded() replaces the recursion with a
+        fixed array of 64 pending ranges. After each partition the larger side is pushed & the smaller side is partitioned next, so every
+        pending range is at least twice the size of the one above it, and the stack can never hold more than log2(n) ranges. The
+        largest stack depth reached is returned as a statistic.
+
+>> Task-Parallel QuickSort: After a partition, the two sides are independent. quickSortParallel() runs a fixed set of threads (the
+        calling thread included, so the machine is never oversubscribed), each owning a lock-free Chase-Lev work-stealing deque. A
+        thread pushes the larger side of every partition larger than the grain on its own deque and carries on with the smaller side,
+        idle threads steal the oldest (largest) tasks from the other deques, and the calling thread returns once every task has
+        finished. Sub-arrays of (grain) or fewer elements are sorted with quickSortBounded(), and a full deque makes the owner sort the
+        task itself.
+
+>> Parallel Partitioning: Even with both sides running in parallel, the first partition is a serial O(n) pass over the whole array (and
+        the next levels barely better), which limits the speedup on many cores. parallelPartitionFunction() partitions one sub-array on
+        all threads: each thread partitions its own chunk, a prefix sum of the chunk counts gives the final boundary, the misplaced
+        elements form at most one interval per chunk on each side of the boundary, and the threads swap equal shares of them into place.
+        It returns the same boundary as partitionFunction(), so partitionTopLevels() simply runs the first (log2(p)) levels of the
+        normal recursion with it, and hands the resulting p sub-arrays to the work-stealing threads. Time O(n/p) per level.
+
+>> Vectorized Partitioning: The scalar partition compares one element at a time. partitionVectorized() is a drop-in alternative to
+        partitionFunction() built on a vectorized split kernel, which compares 8 (AVX2) or 16 (AVX-512) elements against the pivot in
+        one instruction, and writes the lesser & the other lanes to the two ends of the sub-array in place: AVX-512 compress-stores them,
+        AVX2 permutes them with a 256-entry lookup table first. The kernel is picked at runtime from what the CPU supports, with a scalar
+        fallback, and the simd engine sorts with quickSort()'s recursion & the vectorized partition (kernel=scalar | avx2 | avx512).
+
+>> Branchless Partitioning: partitionFunction() only swaps when (dataArray[i] < pivot), a branch the CPU mispredicts about every other
+        element on random data, at a cost of ~15-20 cycles each. partitionBranchless() swaps every element with [pivotIndex] & advances
+        pivotIndex by the result of the comparison (0 or 1), so the loop has no data-dependent branch at all, and partitionCyclic()
+        replaces the swaps with a single cyclic rotation through a hole (2 moves per element instead of a 3-assignment swap). Both return
+        the same pivot index as partitionFunction(), and the recursive engine selects one with partition=branchy | branchless | cyclic.
+
+>> IntroSort (Lomuto's Partitioning Scheme): On sorted or adversarial input, QuickSort degrades to O(n^2) time and O(n) recursion depth,
+        and a stack overflow would crash the whole program. IntroSort runs the same QuickSort recursion, but keeps track of the recursion
+        depth. Once a sub-array has been partitioned (2 * log2(n)) levels deep, QuickSort is clearly not making progress, so that
+        sub-array is sorted with an in-place HeapSort instead (O(n*log(n)) in all cases). Partitions of (16) or fewer elements are
+        finished with InsertionSort, which is faster than partitioning on tiny sub-arrays. The right partition is handled by looping
+        instead of a second recursive call, so the recursion depth never exceeds (2 * log2(n)).
+
+>> Three-Way Partitioning (Dutch National Flag): Lomuto's partitionFunction() only moves elements strictly less (<) than the pivot to
+        the left, so every element equal to the pivot ends up in the right partition. On data that is dominated by a few repeated
+        values (such as data3.txt), almost every partition is maximally unbalanced and QuickSort goes quadratic. The three-way partition
+        keeps the same pivot (the last element), but splits the sub-array into three regions: {elements < pivot}, {elements = pivot},
+        and {elements > pivot}. Pointer (i) scans the unknown region between [lessEnd] and [greaterStart]: elements less than the pivot
+        are swapped to the end of the less region, elements greater than the pivot are swapped to the front of the greater region, and
+        equal elements are left in the middle. All elements equal to the pivot are then in their final position, so QuickSort only
+        recurses on the strictly-less and strictly-greater regions. With (k) distinct values the recursion tree has at most (k) levels
+        of work per element, so few-unique input is sorted in close to linear O(n*k) time.
+
+>> Pivot Selection Policies: partitionFunction() always takes the last element as its pivot, and an adversary can easily
+        build input that makes every partition unbalanced. quickSortWithPolicy<PivotPolicy>() takes the pivot selection rule as a
+        compile-time policy parameter (a struct with a static select() function, so the call is inlined with no runtime cost). The
+        chosen element is swapped into the position partitionFunction() takes its pivot from, so the partitioning scheme itself is
+        unchanged. The policies are:
+            PivotLast - The last element (the original behaviour)
+            PivotMedianOf3 - Median of the first, middle & last elements
+            PivotNinther - Tukey's ninther, the median of the medians of 3 evenly spaced groups of 3 (median of 3 below 128 elements)
+            PivotRandom - A uniformly random element, from a seeded generator so runs are reproducible
+            PivotMedianOfMedians - The deterministic linear-time median of medians (groups of 5), which guarantees that each side of
+                                   the partition holds at least ~30% of the distinct elements (O(n*log(n)) worst-case)
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Unstable Algorithm: QuickSort is an unstable algorithm, meaning that elements with equal values are not guaranteed to retain their
                        relative order in the sorted array.
@@ -65,6 +126,12 @@ elements into sorted order and establishes new partition boundaries.
                                         * (for-each)
                                        O(log(n)) - Depth (levels) of recursion tree, n = # of elements in array
                                         = O(n*log(n))
+
+        IntroSort: O(n*log(n)) - All cases. The QuickSort levels are capped at (2 * log2(n)), and any sub-array that reaches the cap is
+                                 sorted by HeapSort in O(n*log(n)).
+
+        Three-Way: O(n*k) - Input with (k) distinct values, each partitioning level places every copy of its pivot value for good.
+                            Otherwise identical to QuickSort (O(n^2) worst-case on sorted input, O(n*log(n)) average-case).
  -----------------------------------------------------------------------------------------------------------------------------------------
 >> Space Complexity (Lomuto's):
         Worst-case: O(n) - Unbalanced partitions, where each sub-array returned by partition function is of size (n-1). Each nested
@@ -91,6 +158,12 @@ elements into sorted order and establishes new partition boundaries.
                                       * (for-each)
                                      O(log(n)) - Recursive call frames added to the call stack, n = # of elements in array
                                       = O(log(n))
+
+        Bounded: O(log(n)) - All cases. At most log2(n) pending ranges on the fixed work stack, no recursion.
+
+        Parallel: O(p + log(n)) - One fixed deque (256 tasks) & one bounded work stack per thread, p = # of threads.
+
+        IntroSort: O(log(n)) - All cases. At most (2 * log2(n)) recursive call frames, HeapSort & InsertionSort use O(1) space.
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Recursion Tree Diagram (Lomuto's):
         Key: () = Maps to Execution Steps Below, ❰❱ = Pivot Element
@@ -196,15 +269,35 @@ elements into sorted order and establishes new partition boundaries.
          identical to the worst-case time complexity scenario.
 -----------------------------------------------------------------------------------------------------------------------------------------
 >> Compile & Run:
-        g++ quicksort.cpp || g++ quicksort.cpp -g -o quicksort
+        g++ quicksort.cpp -pthread || g++ quicksort.cpp -pthread -g -o quicksort
         ./a.out || valgrind ./a.out || valgrind ./quicksort || valgrind --leak-check=full ./quicksort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = recursive (default) | bounded | parallel | simd | intro | threeway | last | median3 | ninther | random | mom | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 1000000)
+            options = cutoff=16 (insertion sort partition size)
+                      seed=1 (random pivot policy seed)
+                      threads=<hardware threads> (parallel engine thread count)
+                      grain=16384 (largest sub-array the parallel engine sorts sequentially)
+                      ppart=1 (parallel engine partitions its first levels with all threads, 0 = one thread)
+                      kernel=auto (simd engine split kernel: auto | scalar | avx2 | avx512)
+                      partition=branchy (recursive engine partition scheme: branchy | branchless | cyclic)
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
 
-#include <iostream> // cout
-#include <fstream>  // ifstream
-#include <sstream>  // stringstream
-#include <string>   // string
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort
+#include <thread>    // thread, hardware_concurrency, yield
+#include <atomic>    // atomic, atomic_thread_fence
+#include <memory>    // unique_ptr
+#include <functional> // function
 
 using namespace std;
 
@@ -274,104 +367,2096 @@ void quickSort(int dataArray[], int low, int high)
 
 /*
 -----------------------------------------------------------------------------------------------------------------------------------------
-The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
-format.
+The PartitionScheme type is a Lomuto partition function: it partitions the sub-array around its last element, and returns the pivot's
+new position. partitionFunction(), partitionBranchless() & partitionCyclic() all have this signature, and all return the same index.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+typedef int (*PartitionScheme)(int dataArray[], int low, int high);
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionBranchless() function partitions the sub-array exactly like partitionFunction(), but without the data-dependent branch:
+every element is swapped with [pivotIndex], and pivotIndex advances by the result of the comparison (0 or 1). An element that is not
+less than the pivot is swapped with another element that is not less than the pivot (or with itself), which changes nothing that
+matters. The branchy version mispredicts about every other element on random data, this one always does the same work.
     >> Parameters:
             int dataArray[] - Pointer to array of integers
-            int arraySize - Size of the array to be printed
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+    >> Return:
+            int pivotIndex - Index of the pivot element's new position
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
-void printArray(int dataArray[], int arraySize)
+int partitionBranchless(int dataArray[], int low, int high)
 {
-    for (int i = 0; i < arraySize; i++)
+    int pivot = dataArray[high]; // Last element
+    int pivotIndex = low;        // [low] -> [pivotIndex - 1] are less than the pivot
+
+    for (int i = low; i < high; i++)
     {
-        if ((i % 25) == 0) // New line every 25 elements printed
-        {
-            cout << endl
-                 << "   "; // Indent each new line
-        }
-        if (i == (arraySize - 1)) // Last element
+        int value = dataArray[i];
+        dataArray[i] = dataArray[pivotIndex]; // Unconditional swap of [i] & [pivotIndex]
+        dataArray[pivotIndex] = value;
+        pivotIndex += (value < pivot); // Advance only if the element belongs to the left partition
+    }
+
+    int temp = dataArray[high]; // Swap the pivot into its final position
+    dataArray[high] = dataArray[pivotIndex];
+    dataArray[pivotIndex] = temp;
+
+    return pivotIndex;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionCyclic() function is the branchless partition with the swaps replaced by one cyclic rotation. The first element is lifted
+out of the array, which leaves a hole. For every next element [i], the first element of the right partition ([pivotIndex]) moves into
+the hole at [i - 1], and [i] moves into [pivotIndex], so the hole is now at [i]. Each element costs 2 moves & no temporary instead of
+a 3-assignment swap, and the comparison is done on the value already in a register. The lifted element finally fills the last hole.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+    >> Return:
+            int pivotIndex - Index of the pivot element's new position
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int partitionCyclic(int dataArray[], int low, int high)
+{
+    if (low >= high)
+    {
+        return high; // Only the pivot
+    }
+
+    int pivot = dataArray[high]; // Last element
+    int lifted = dataArray[low]; // Lifted out of the array, the hole starts at [low]
+    int pivotIndex = low;        // [low] -> [pivotIndex - 1] are less than the pivot
+
+    for (int i = low + 1; i < high; i++) // The hole is at [i - 1]
+    {
+        int value = dataArray[i];
+        dataArray[i - 1] = dataArray[pivotIndex]; // First element of the right partition fills the hole
+        dataArray[pivotIndex] = value;            // [i] takes its place, the hole moves to [i]
+        pivotIndex += (value < pivot);
+    }
+
+    dataArray[high - 1] = dataArray[pivotIndex]; // Close the last hole with the lifted element
+    dataArray[pivotIndex] = lifted;
+    pivotIndex += (lifted < pivot);
+
+    int temp = dataArray[high]; // Swap the pivot into its final position
+    dataArray[high] = dataArray[pivotIndex];
+    dataArray[pivotIndex] = temp;
+
+    return pivotIndex;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The selectPartitionScheme() function looks up a PartitionScheme by name.
+    >> Parameters:
+            const string &name - branchy (partitionFunction()) | branchless | cyclic
+    >> Return:
+            PartitionScheme - The partition function, nullptr if the name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+PartitionScheme selectPartitionScheme(const string &name)
+{
+    if (name == "branchy")
+    {
+        return partitionFunction;
+    }
+    if (name == "branchless")
+    {
+        return partitionBranchless;
+    }
+    if (name == "cyclic")
+    {
+        return partitionCyclic;
+    }
+
+    return nullptr;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSort() overload runs the same recursion as quickSort() with the given PartitionScheme in place of partitionFunction().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            PartitionScheme partition - Partition function to use
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSort(int dataArray[], int low, int high, PartitionScheme partition)
+{
+    if (low < high)
+    {
+        int pivotIndex = partition(dataArray, low, high);
+        quickSort(dataArray, low, (pivotIndex - 1), partition);
+        quickSort(dataArray, (pivotIndex + 1), high, partition);
+    }
+}
+
+const int WORK_STACK_CAPACITY = 64; // Entries of the quickSortBounded() work stack, more than log2(n) for any int sized array
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The WorkRange struct holds the low & high indices of a sub-array waiting on the quickSortBounded() work stack.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct WorkRange
+{
+    int low;
+    int high;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortBounded() function sorts the segment of the array between the low & high indices with the same partitions as quickSort(),
+but without recursion. After each partition, the larger side is pushed on a fixed-capacity work stack and the loop continues with the
+smaller side. Every range processed after a push is at most half the size of the range it was split from, so at most log2(n) ranges are
+ever waiting on the stack, whatever the input (the time can still be O(n^2), the space cannot be more than O(log(n))). Pushing the
+smaller side instead would let one pending range pile up per partition, O(n) in the worst case. Sides of fewer than 2 elements are
+already sorted & never pushed.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+    >> Return:
+            int maxDepth - Largest number of ranges that were waiting on the work stack at once
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int quickSortBounded(int dataArray[], int low, int high)
+{
+    WorkRange workStack[WORK_STACK_CAPACITY]; // Fixed-capacity work stack, never grows
+    int top = 0;                              // Number of ranges on the work stack
+    int maxDepth = 0;                         // Largest value of (top) so far
+
+    workStack[top++] = {low, high};
+
+    while (top > 0)
+    {
+        WorkRange range = workStack[--top];
+
+        while (range.low < range.high) // If the range has more than 1 element
         {
-            if (dataArray[i] < 10) // If single-digit & last
-            {
-                cout << " " << dataArray[i] << endl; // Add extra space
-            }
-            else // Otherwise just print the element
+            int pivotIndex = partitionFunction(dataArray, range.low, range.high);
+
+            WorkRange left = {range.low, (pivotIndex - 1)};
+            WorkRange right = {(pivotIndex + 1), range.high};
+            bool leftIsSmaller = (left.high - left.low) < (right.high - right.low);
+
+            WorkRange larger = leftIsSmaller ? right : left;
+            range = leftIsSmaller ? left : right; // Continue with the smaller side
+
+            if (larger.low < larger.high) // Defer the larger side
             {
-                cout << dataArray[i] << endl;
+                workStack[top++] = larger;
+                maxDepth = (top > maxDepth) ? top : maxDepth;
             }
         }
-        else // Element is not last
+    }
+
+    return maxDepth;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSort() function sorts the sub-array bounded by [low] & [high] in place. This is the InsertionSort kernel from
+InsertionSort/insertionsort.cpp, restricted to a range so that it can finish the small partitions of IntroSort.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSort(int dataArray[], int low, int high)
+{
+    for (int i = low + 1; i <= high; i++)
+    {
+        int element = dataArray[i]; // Get the element stored at current index
+        int index = i;              // Set index = to the index of the selected element
+
+        while ((index > low) && (dataArray[index - 1] > element)) // Shift every greater element one position to the right
         {
-            if (dataArray[i] < 10) // If single-digit & not last
-            {
-                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
-            }
-            else // Otherwise just add a trailing comma
-            {
-                cout << dataArray[i] << ", ";
-            }
+            dataArray[index] = dataArray[index - 1];
+            index--;
         }
+
+        dataArray[index] = element; // Insert the element at its correct position within the sorted sub-array
     }
 }
 
 /*
 -----------------------------------------------------------------------------------------------------------------------------------------
-main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
-# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
-terminal before and after the QuickSort algorithm is performed.
+The siftDown() function restores the max-heap property of the heap stored in dataArray[low] -> dataArray[low + heapSize - 1], by moving
+the element at heap position (root) down until both of its children are smaller or equal. Heap position (k) has its children at
+positions (2k + 1) & (2k + 2).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element of the heap
+            int root - Heap position of the element to be moved down
+            int heapSize - Number of elements in the heap
 -----------------------------------------------------------------------------------------------------------------------------------------
 */
-int main()
+void siftDown(int dataArray[], int low, int root, int heapSize)
 {
-    // Read the data from file
-    ifstream infile("data1.txt");
+    int element = dataArray[low + root]; // Element being moved down
 
-    if (!infile)
+    while ((2 * root) + 1 < heapSize)
     {
-        cerr << "ERROR - File Not Found" << endl;
-        return 1;
+        int child = (2 * root) + 1; // Left child
+
+        if (child + 1 < heapSize && dataArray[low + child] < dataArray[low + child + 1])
+        {
+            child++; // The right child is larger
+        }
+
+        if (dataArray[low + child] <= element)
+        {
+            break; // Both children are smaller or equal -> Heap property restored
+        }
+
+        dataArray[low + root] = dataArray[low + child]; // Move the larger child up
+        root = child;
     }
 
-    int arraySize = 0;        // Number of integers to be sorted (Size of array)
-    infile >> arraySize;      // Size is first line of data file
-    int dataArray[arraySize]; // To hold our data to be sorted
+    dataArray[low + root] = element;
+}
 
-    if (arraySize <= 0) // Check valid # of integers
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The heapSort() function sorts the sub-array bounded by [low] & [high] in place in O(n*log(n)) time. The sub-array is first turned into
+a max-heap, then the largest element (the root) is repeatedly swapped to the end of the heap and the heap shrinks by one.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void heapSort(int dataArray[], int low, int high)
+{
+    int heapSize = (high - low) + 1;
+
+    for (int root = (heapSize / 2) - 1; root >= 0; root--) // Build the max-heap bottom-up
     {
-        cerr << "ERROR - Invalid Number Of Integers" << endl;
-        return 1;
+        siftDown(dataArray, low, root, heapSize);
     }
 
-    int index = 0; // Index to insert element into dataArray
-    string line;
+    for (int last = heapSize - 1; last > 0; last--)
+    {
+        int temp = dataArray[low];              // Largest remaining element (root)
+        dataArray[low] = dataArray[low + last]; // Move the last heap element to the root
+        dataArray[low + last] = temp;           // The largest element is now in its sorted position
+        siftDown(dataArray, low, 0, last);      // Restore the heap on the remaining (last) elements
+    }
+}
 
-    while (getline(infile, line)) // Get the next line of data after arraySize
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The introSort() function (recursive part) sorts the segment of the array between the low & high indices with QuickSort, until the
+recursion reaches the depth limit, where the segment is sorted with heapSort() instead. Partitions of (cutoff) or fewer elements are
+finished with insertionSort().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int depthLimit - Number of partitioning levels left before falling back to heapSort()
+            int cutoff - Largest partition size finished by insertionSort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void introSort(int dataArray[], int low, int high, int depthLimit, int cutoff)
+{
+    while ((high - low) + 1 > cutoff) // Partitions of (cutoff) or fewer elements are left for insertionSort()
     {
-        if (line == "")
+        if (depthLimit == 0) // QuickSort is not making progress on this sub-array -> Fall back to HeapSort
         {
-            continue; // Skip empty lines
+            heapSort(dataArray, low, high);
+            return;
         }
+        depthLimit--;
 
-        stringstream ss(line); // To parse each line
-        int element;           // To store each integer delimited by a space " "
+        int pivotIndex = partitionFunction(dataArray, low, high); // Get the index of the pivot's new position
 
-        // While there is a next integer and there are more integers's to store
-        while ((ss >> element) && (index < arraySize))
+        introSort(dataArray, low, (pivotIndex - 1), depthLimit, cutoff); // Recursive call for left partition
+        low = pivotIndex + 1;                                            // Loop on the right partition
+    }
+
+    insertionSort(dataArray, low, high);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The introSort() function is the entry point of IntroSort. It sets the depth limit to (2 * log2(n)) partitioning levels and sorts the
+segment of the array between the low & high indices.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int cutoff - Largest partition size finished by insertionSort() (default 16)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void introSort(int dataArray[], int low, int high, int cutoff = 16)
+{
+    int depthLimit = 0; // 2 * floor(log2(n))
+    for (int size = (high - low) + 1; size > 1; size /= 2)
+    {
+        depthLimit += 2;
+    }
+
+    introSort(dataArray, low, high, depthLimit, (cutoff < 1) ? 1 : cutoff);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionThreeWay() function partitions the dataArray segment around the pivot (the last element, as in Lomuto's scheme) into three
+regions: elements less than the pivot, elements equal to the pivot, and elements greater than the pivot (Dutch national flag).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int &lessEnd - Receives the index of the first element equal to the pivot
+            int &greaterStart - Receives the index of the last element equal to the pivot
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void partitionThreeWay(int dataArray[], int low, int high, int &lessEnd, int &greaterStart)
+{
+    int pivot = dataArray[high]; // Set pivot = dataArray[high] (element stored in highest index of the sub-array)
+    int lt = low;                // Elements [low] -> [lt - 1] are less than the pivot
+    int i = low;                 // Elements [lt] -> [i - 1] are equal to the pivot
+    int gt = high;               // Elements [gt + 1] -> [high] are greater than the pivot, [i] -> [gt] are not yet classified
+
+    while (i <= gt)
+    {
+        if (dataArray[i] < pivot) // Less -> Swap to the end of the less region
         {
-            dataArray[index++] = element; // Store the integer @ index, then increment the index
+            int temp = dataArray[i];
+            dataArray[i] = dataArray[lt];
+            dataArray[lt] = temp;
+            lt++;
+            i++;
+        }
+        else if (dataArray[i] > pivot) // Greater -> Swap to the front of the greater region (The swapped-in element is unclassified)
+        {
+            int temp = dataArray[i];
+            dataArray[i] = dataArray[gt];
+            dataArray[gt] = temp;
+            gt--;
+        }
+        else // Equal -> Leave it in the middle region
+        {
+            i++;
         }
     }
 
-    // Print unsorted array
-    cout << endl
-         << "Array before sorting:";
-    printArray(dataArray, arraySize);
+    lessEnd = lt;
+    greaterStart = gt;
+}
 
-    cout << endl
-         << "Running QuickSort - Lomuto's Partitioning Scheme..." << endl;
-    // Call the quickSort() function to sort the array
-    quickSort(dataArray, 0, (arraySize - 1));
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortThreeWay() function recursively sorts the segment of the array between the low & high indices with partitionThreeWay().
+Elements equal to the pivot are already in their final position, so only the strictly-less and strictly-greater regions are sorted.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSortThreeWay(int dataArray[], int low, int high)
+{
+    if (low < high) // If the dataArray segment has more than 1 element
+    {
+        int lessEnd = 0;      // First index of the equal region
+        int greaterStart = 0; // Last index of the equal region
+        partitionThreeWay(dataArray, low, high, lessEnd, greaterStart);
+
+        quickSortThreeWay(dataArray, low, (lessEnd - 1));      // Recursive call for the strictly-less region
+        quickSortThreeWay(dataArray, (greaterStart + 1), high); // Recursive call for the strictly-greater region
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The PivotLast policy selects the last element of the sub-array, exactly like partitionFunction() (the original behaviour).
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct PivotLast
+{
+    static int select(int dataArray[], int low, int high)
+    {
+        (void)dataArray;
+        (void)low;
+        return high;
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The medianOf3() function returns the index of the median of the three elements stored at the given indices.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int a, b, c - Indices of the three elements
+    >> Return:
+            int - Index of the median element
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int medianOf3(int dataArray[], int a, int b, int c)
+{
+    if (dataArray[a] < dataArray[b])
+    {
+        if (dataArray[b] < dataArray[c])
+        {
+            return b; // a < b < c
+        }
+        return (dataArray[a] < dataArray[c]) ? c : a; // a < b, c <= b
+    }
+
+    if (dataArray[a] < dataArray[c])
+    {
+        return a; // b <= a < c
+    }
+    return (dataArray[b] < dataArray[c]) ? c : b; // b <= a, c <= a
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The PivotMedianOf3 policy selects the median of the first, middle & last elements of the sub-array. Sorted & reverse-sorted input then
+always partitions in half.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct PivotMedianOf3
+{
+    static int select(int dataArray[], int low, int high)
+    {
+        return medianOf3(dataArray, low, low + (high - low) / 2, high);
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The PivotNinther policy selects Tukey's ninther: the median of the medians of three groups of three elements, spread evenly over the
+sub-array. It approximates the true median much better than median of 3, for only 12 comparisons. Sub-arrays of fewer than 128 elements
+use median of 3.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct PivotNinther
+{
+    static int select(int dataArray[], int low, int high)
+    {
+        int size = (high - low) + 1;
+        int middle = low + (high - low) / 2;
+
+        if (size < 128)
+        {
+            return medianOf3(dataArray, low, middle, high);
+        }
+
+        int step = size / 8;
+        int first = medianOf3(dataArray, low, low + step, low + 2 * step);
+        int second = medianOf3(dataArray, middle - step, middle, middle + step);
+        int third = medianOf3(dataArray, high - 2 * step, high - step, high);
+
+        return medianOf3(dataArray, first, second, third);
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The PivotRandom policy selects a uniformly random element of the sub-array. The generator (xorshift64*) is seeded, so that a run can be
+reproduced exactly, while an adversary who does not know the seed cannot build a bad input.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct PivotRandom
+{
+    static unsigned long long &state()
+    {
+        static unsigned long long generatorState = 0x9E3779B97F4A7C15ULL; // Default seed
+        return generatorState;
+    }
+
+    static void seed(unsigned long long value)
+    {
+        state() = (value * 0x9E3779B97F4A7C15ULL) | 1ULL; // Scramble the seed, xorshift state must never be 0
+    }
+
+    static int select(int dataArray[], int low, int high)
+    {
+        (void)dataArray;
+
+        unsigned long long &x = state(); // xorshift64* step
+        x ^= x >> 12;
+        x ^= x << 25;
+        x ^= x >> 27;
+        unsigned long long random = x * 0x2545F4914F6CDD1DULL;
+
+        unsigned long long size = (unsigned long long)(high - low) + 1;
+        return low + (int)((random >> 32) % size);
+    }
+};
+
+int selectKth(int dataArray[], int low, int high, int k);
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The medianOfMedians() function returns the index of the median of medians of the sub-array: the sub-array is split into groups of 5,
+each group is sorted and its median is moved to the front of the sub-array, and the median of those medians is found with selectKth().
+The elements of the sub-array are rearranged.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+    >> Return:
+            int - Index of the median of medians
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int medianOfMedians(int dataArray[], int low, int high)
+{
+    int groups = 0; // Number of group medians moved to the front so far
+
+    for (int groupLow = low; groupLow <= high; groupLow += 5)
+    {
+        int groupHigh = (groupLow + 4 < high) ? (groupLow + 4) : high;
+        insertionSort(dataArray, groupLow, groupHigh); // Sort the group of (at most) 5 elements
+
+        int median = groupLow + (groupHigh - groupLow) / 2;
+        int temp = dataArray[low + groups]; // Move the group median to the front of the sub-array
+        dataArray[low + groups] = dataArray[median];
+        dataArray[median] = temp;
+        groups++;
+    }
+
+    return selectKth(dataArray, low, (low + groups - 1), (low + (groups - 1) / 2));
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The selectKth() function rearranges the sub-array so that the element at index [k] is the one that would be there if the sub-array were
+sorted, in worst-case linear time (BFPRT selection). The sub-array is three-way partitioned around its median of medians, and the search
+continues in whichever region contains index [k].
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+            int k - Index to be selected (low <= k <= high)
+    >> Return:
+            int k - Index of the selected element
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int selectKth(int dataArray[], int low, int high, int k)
+{
+    while ((high - low) + 1 > 5)
+    {
+        int pivot = dataArray[medianOfMedians(dataArray, low, high)];
+
+        int lt = low;  // [low] -> [lt - 1] < pivot
+        int i = low;   // [lt] -> [i - 1] = pivot
+        int gt = high; // [gt + 1] -> [high] > pivot
+        while (i <= gt)
+        {
+            if (dataArray[i] < pivot)
+            {
+                int temp = dataArray[i];
+                dataArray[i++] = dataArray[lt];
+                dataArray[lt++] = temp;
+            }
+            else if (dataArray[i] > pivot)
+            {
+                int temp = dataArray[i];
+                dataArray[i] = dataArray[gt];
+                dataArray[gt--] = temp;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (k < lt)
+        {
+            high = lt - 1; // Continue in the less region
+        }
+        else if (k > gt)
+        {
+            low = gt + 1; // Continue in the greater region
+        }
+        else
+        {
+            return k; // Index [k] holds the pivot value
+        }
+    }
+
+    insertionSort(dataArray, low, high);
+    return k;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The PivotMedianOfMedians policy selects the true median of the sub-array, found by the deterministic linear-time selectKth(). This
+guarantees balanced partitions on every input, at the cost of a much larger constant factor than the sampling policies.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct PivotMedianOfMedians
+{
+    static int select(int dataArray[], int low, int high)
+    {
+        return selectKth(dataArray, low, high, low + (high - low) / 2);
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionWithPolicy() function picks the pivot with the PivotPolicy, swaps the chosen pivot into the last position [high], where
+partitionFunction() expects it, and partitions the sub-array.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+    >> Return:
+            int - Index of the pivot element's new position (see partitionFunction())
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename PivotPolicy>
+int partitionWithPolicy(int dataArray[], int low, int high)
+{
+    int pivotIndex = PivotPolicy::select(dataArray, low, high);
+
+    int temp = dataArray[pivotIndex]; // Swap the chosen pivot into the last position, where partitionFunction() takes its pivot from
+    dataArray[pivotIndex] = dataArray[high];
+    dataArray[high] = temp;
+
+    return partitionFunction(dataArray, low, high);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortWithPolicy() function recursively sorts the segment of the array between the low & high indices exactly like quickSort(),
+with the pivot of every partition chosen by the compile-time PivotPolicy.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename PivotPolicy>
+void quickSortWithPolicy(int dataArray[], int low, int high)
+{
+    if (low < high) // If the dataArray segment has more than 1 element
+    {
+        int pivotIndex = partitionWithPolicy<PivotPolicy>(dataArray, low, high); // Get the index of the pivot's new position
+
+        quickSortWithPolicy<PivotPolicy>(dataArray, low, (pivotIndex - 1));  // Recursive call for left partition
+        quickSortWithPolicy<PivotPolicy>(dataArray, (pivotIndex + 1), high); // Recursive call for right partition
+    }
+}
+
+const int DEQUE_CAPACITY = 256; // Tasks held by each ChaseLevDeque, a full deque makes the owner sort the task itself
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The ChaseLevDeque class is a lock-free work-stealing deque (Chase & Lev, with the C11 memory orders of Le et al.) of fixed capacity.
+The owning thread pushes & pops tasks at the bottom (LIFO) without any lock, and other threads steal the oldest task from the top (FIFO)
+with a single compare-and-swap, so the owner & the thieves only contend when one task is left. A task is a sub-array (low, high), packed
+into one 64-bit atomic slot so that a thief never reads a half-written task.
+    >> Members:
+            atomic<long long> top - Index of the oldest task (advanced by thieves & the owner's last pop)
+            atomic<long long> bottom - Index one past the newest task (only written by the owner)
+            atomic<unsigned long long> slots[] - Circular buffer of packed tasks
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+class ChaseLevDeque
+{
+public:
+    ChaseLevDeque() : top(0), bottom(0)
+    {
+        for (int i = 0; i < DEQUE_CAPACITY; i++)
+        {
+            slots[i].store(0, memory_order_relaxed);
+        }
+    }
+
+    ChaseLevDeque(const ChaseLevDeque &) = delete;
+    ChaseLevDeque &operator=(const ChaseLevDeque &) = delete;
+
+    // Owner only: push a task at the bottom, returns false if the deque is full
+    bool push(int low, int high)
+    {
+        long long b = bottom.load(memory_order_relaxed);
+        long long t = top.load(memory_order_acquire);
+
+        if (b - t >= DEQUE_CAPACITY)
+        {
+            return false;
+        }
+
+        slots[b % DEQUE_CAPACITY].store(pack(low, high), memory_order_relaxed);
+        bottom.store(b + 1, memory_order_release); // The task (& the partitioned sub-array) is visible before the new bottom
+        return true;
+    }
+
+    // Owner only: pop the newest task from the bottom, returns false if the deque is empty (or a thief took the last task)
+    bool pop(int &low, int &high)
+    {
+        long long b = bottom.load(memory_order_relaxed) - 1;
+        bottom.store(b, memory_order_relaxed); // Reserve the bottom task before looking at top
+        atomic_thread_fence(memory_order_seq_cst);
+        long long t = top.load(memory_order_relaxed);
+
+        if (t > b) // Empty
+        {
+            bottom.store(b + 1, memory_order_relaxed);
+            return false;
+        }
+
+        unpack(slots[b % DEQUE_CAPACITY].load(memory_order_relaxed), low, high);
+
+        if (t == b) // Last task -> Race the thieves for it
+        {
+            bool won = top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+            bottom.store(b + 1, memory_order_relaxed);
+            return won;
+        }
+
+        return true;
+    }
+
+    // Any other thread: steal the oldest task from the top, returns false if the deque is empty or another thread won the race
+    bool steal(int &low, int &high)
+    {
+        long long t = top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        long long b = bottom.load(memory_order_acquire);
+
+        if (t >= b)
+        {
+            return false;
+        }
+
+        unsigned long long task = slots[t % DEQUE_CAPACITY].load(memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+        {
+            return false;
+        }
+
+        unpack(task, low, high);
+        return true;
+    }
+
+private:
+    alignas(64) atomic<long long> top;    // Own cache lines, thieves hammer top while the owner works on bottom
+    alignas(64) atomic<long long> bottom;
+    alignas(64) atomic<unsigned long long> slots[DEQUE_CAPACITY];
+
+    static unsigned long long pack(int low, int high)
+    {
+        return ((unsigned long long)(unsigned int)low << 32) | (unsigned int)high;
+    }
+
+    static void unpack(unsigned long long task, int &low, int &high)
+    {
+        low = (int)(unsigned int)(task >> 32);
+        high = (int)(unsigned int)task;
+    }
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The ParallelSortState struct is shared by all threads of one quickSortParallel() call.
+    >> Members:
+            int *dataArray - Pointer to the array being sorted
+            int grain - Largest sub-array sorted sequentially (never split into tasks)
+            vector<unique_ptr<ChaseLevDeque>> deques - One deque per thread, thread [0] is the calling thread
+            atomic<int> pendingTasks - Tasks pushed or running that have not finished yet, the sort is done when it reaches 0
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct ParallelSortState
+{
+    int *dataArray;
+    int grain;
+    vector<unique_ptr<ChaseLevDeque>> deques;
+    atomic<int> pendingTasks{0};
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runSortTask() function sorts one task (sub-array). While the sub-array is larger than the grain it is partitioned, the larger side is
+pushed on the thread's own deque where idle threads can steal it, and the loop continues with the smaller side, so the own deque holds
+at most log2(n) tasks. If the deque is full the larger side is sorted right away instead. Sub-arrays of (grain) or fewer elements are
+sorted with quickSortBounded(), which keeps the small worker thread stacks safe.
+    >> Parameters:
+            ParallelSortState &state - Shared state of the parallel sort
+            int self - Index of the calling thread (& its deque)
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runSortTask(ParallelSortState &state, int self, int low, int high)
+{
+    while ((high - low) + 1 > state.grain)
+    {
+        int pivotIndex = partitionFunction(state.dataArray, low, high);
+
+        int leftLow = low, leftHigh = (pivotIndex - 1);
+        int rightLow = (pivotIndex + 1), rightHigh = high;
+        if ((leftHigh - leftLow) < (rightHigh - rightLow)) // Make (left) the larger side
+        {
+            swap(leftLow, rightLow);
+            swap(leftHigh, rightHigh);
+        }
+
+        state.pendingTasks++;
+        if (!state.deques[self]->push(leftLow, leftHigh)) // Spawn the larger side as a stealable task
+        {
+            quickSortBounded(state.dataArray, leftLow, leftHigh); // Deque full -> Sort it inline
+            state.pendingTasks--;
+        }
+
+        low = rightLow; // Continue with the smaller side
+        high = rightHigh;
+    }
+
+    quickSortBounded(state.dataArray, low, high);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parallelSortWorker() function is run by every thread of the parallel sort, including the calling thread. It runs the tasks of its
+own deque (newest first), steals the oldest task of the other deques when its own is empty, and returns once every task has finished.
+    >> Parameters:
+            ParallelSortState &state - Shared state of the parallel sort
+            int self - Index of the calling thread (& its deque)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void parallelSortWorker(ParallelSortState &state, int self)
+{
+    int threadCount = (int)state.deques.size();
+    int low = 0, high = 0;
+
+    while (state.pendingTasks.load() > 0)
+    {
+        bool found = state.deques[self]->pop(low, high);
+
+        for (int offset = 1; !found && offset < threadCount; offset++) // Own deque empty -> Try to steal from the others
+        {
+            found = state.deques[(self + offset) % threadCount]->steal(low, high);
+        }
+
+        if (!found)
+        {
+            this_thread::yield(); // Nothing to do yet, let the threads holding tasks run
+            continue;
+        }
+
+        runSortTask(state, self, low, high);
+        state.pendingTasks--;
+    }
+}
+
+const int PARALLEL_PARTITION_MIN = 65536; // Smallest sub-array partitioned by all threads in parallelPartitionFunction()
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runOnThreads() function runs body(0) -> body(threadCount - 1) at the same time, body(0) on the calling thread, and returns once all
+of them have finished.
+    >> Parameters:
+            int threadCount - Number of threads, including the calling thread
+            const function<void(int)> &body - Work of one thread, given the thread index
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runOnThreads(int threadCount, const function<void(int)> &body)
+{
+    vector<thread> helpers;
+    for (int t = 1; t < threadCount; t++)
+    {
+        helpers.push_back(thread(body, t));
+    }
+
+    body(0);
+
+    for (thread &helper : helpers)
+    {
+        helper.join();
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionChunk() function splits the sub-array in place into the elements less than the pivot value followed by the rest, with two
+pointers moving towards each other (the pivot does not have to be in the sub-array).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+            int pivot - Pivot value
+    >> Return:
+            int - Number of elements less than the pivot
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int partitionChunk(int dataArray[], int low, int high, int pivot)
+{
+    int i = low;
+    int j = high;
+
+    while (true)
+    {
+        while (i <= j && dataArray[i] < pivot)
+        {
+            i++;
+        }
+        while (i <= j && !(dataArray[j] < pivot))
+        {
+            j--;
+        }
+
+        if (i >= j)
+        {
+            return i - low;
+        }
+
+        swap(dataArray[i++], dataArray[j--]);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parallelSplit() function splits the sub-array in place into the elements less than the pivot value followed by the rest, on
+(threadCount) threads:
+    (1) Every thread splits its own contiguous chunk with partitionChunk() & counts its elements less than the pivot.
+    (2) A prefix sum over the counts gives the final boundary. Every "less" element of a chunk at or after the boundary, and every
+        "greater or equal" element before it, is misplaced, and there are exactly as many of one kind as of the other. Each chunk
+        contributes at most one interval of each kind, so the misplaced elements are listed as two short lists of intervals.
+    (3) The k-th misplaced "less" element is swapped with the k-th misplaced "greater" element, and the swaps are divided evenly
+        between the threads.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+            int pivot - Pivot value
+            int threadCount - Number of threads, including the calling thread
+    >> Return:
+            int - Index of the first element that is not less than the pivot (high + 1 if there is none)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int parallelSplit(int dataArray[], int low, int high, int pivot, int threadCount)
+{
+    int size = (high - low) + 1;
+    vector<int> lessCounts(threadCount);
+
+    // (1) Split every chunk locally
+    runOnThreads(threadCount, [&](int t) {
+        int chunkLow = low + (int)((long long)size * t / threadCount);
+        int chunkHigh = low + (int)((long long)size * (t + 1) / threadCount) - 1;
+        lessCounts[t] = partitionChunk(dataArray, chunkLow, chunkHigh, pivot);
+    });
+
+    // (2) Prefix sum -> Boundary, then list the misplaced intervals on both sides of it
+    int boundary = low;
+    for (int t = 0; t < threadCount; t++)
+    {
+        boundary += lessCounts[t];
+    }
+
+    vector<WorkRange> misplacedLess;    // "Less" elements at or after the boundary
+    vector<WorkRange> misplacedGreater; // "Greater or equal" elements before the boundary
+    for (int t = 0; t < threadCount; t++)
+    {
+        int chunkLow = low + (int)((long long)size * t / threadCount);
+        int chunkHigh = low + (int)((long long)size * (t + 1) / threadCount) - 1;
+        int chunkSplit = chunkLow + lessCounts[t]; // First "greater or equal" element of the chunk
+
+        WorkRange less = {(chunkLow > boundary) ? chunkLow : boundary, chunkSplit - 1};
+        WorkRange greater = {chunkSplit, (chunkHigh < boundary - 1) ? chunkHigh : (boundary - 1)};
+        if (less.low <= less.high)
+        {
+            misplacedLess.push_back(less);
+        }
+        if (greater.low <= greater.high)
+        {
+            misplacedGreater.push_back(greater);
+        }
+    }
+
+    long long misplaced = 0; // Number of swaps needed
+    for (const WorkRange &range : misplacedLess)
+    {
+        misplaced += (range.high - range.low) + 1;
+    }
+
+    // (3) Swap the k-th misplaced "less" element with the k-th misplaced "greater" element, each thread takes an equal share of k
+    runOnThreads(threadCount, [&](int t) {
+        long long first = misplaced * t / threadCount;
+        long long last = misplaced * (t + 1) / threadCount;
+        if (first >= last)
+        {
+            return; // No swaps for this thread
+        }
+
+        size_t lessRange = 0, greaterRange = 0; // Find the position of the (first) misplaced element in both lists
+        long long lessOffset = first, greaterOffset = first;
+        while (lessRange < misplacedLess.size() && lessOffset > misplacedLess[lessRange].high - misplacedLess[lessRange].low)
+        {
+            lessOffset -= (misplacedLess[lessRange].high - misplacedLess[lessRange].low) + 1;
+            lessRange++;
+        }
+        while (greaterRange < misplacedGreater.size() &&
+               greaterOffset > misplacedGreater[greaterRange].high - misplacedGreater[greaterRange].low)
+        {
+            greaterOffset -= (misplacedGreater[greaterRange].high - misplacedGreater[greaterRange].low) + 1;
+            greaterRange++;
+        }
+
+        int i = misplacedLess[lessRange].low + (int)lessOffset;
+        int j = misplacedGreater[greaterRange].low + (int)greaterOffset;
+        for (long long k = first; k < last; k++)
+        {
+            if (i > misplacedLess[lessRange].high) // Continue with the next interval
+            {
+                i = misplacedLess[++lessRange].low;
+            }
+            if (j > misplacedGreater[greaterRange].high)
+            {
+                j = misplacedGreater[++greaterRange].low;
+            }
+            swap(dataArray[i++], dataArray[j++]);
+        }
+    });
+
+    return boundary;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parallelPartitionFunction() function partitions the sub-array around the last element exactly like partitionFunction(), using all
+(threadCount) threads through parallelSplit(), and moves the pivot into its final position.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int threadCount - Number of threads, including the calling thread
+    >> Return:
+            int pivotIndex - Index of the pivot element's new position
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int parallelPartitionFunction(int dataArray[], int low, int high, int threadCount)
+{
+    int pivot = dataArray[high];
+
+    int pivotIndex = parallelSplit(dataArray, low, (high - 1), pivot, threadCount); // First element not less than the pivot
+    swap(dataArray[pivotIndex], dataArray[high]);                                   // Pivot between the two sides
+
+    return pivotIndex;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionTopLevels() function runs the first levels of the QuickSort recursion with parallelPartitionFunction(), so that the first
+O(n) partitioning passes use every thread instead of one. It keeps splitting until the sub-array has been given (parts) = 1 share of the
+threads or is smaller than PARALLEL_PARTITION_MIN, and collects the resulting sub-arrays as the first tasks of quickSortParallel().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int threadCount - Number of threads, including the calling thread
+            int parts - Number of tasks this sub-array should be split into
+            vector<WorkRange> &ranges - Receives the unsorted sub-arrays, in order
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void partitionTopLevels(int dataArray[], int low, int high, int threadCount, int parts, vector<WorkRange> &ranges)
+{
+    if (parts <= 1 || (high - low) + 1 < PARALLEL_PARTITION_MIN)
+    {
+        ranges.push_back({low, high});
+        return;
+    }
+
+    int pivotIndex = parallelPartitionFunction(dataArray, low, high, threadCount);
+
+    partitionTopLevels(dataArray, low, (pivotIndex - 1), threadCount, (parts / 2), ranges);                 // Left partition
+    partitionTopLevels(dataArray, (pivotIndex + 1), high, threadCount, (parts - parts / 2), ranges); // Right partition
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortParallel() function sorts the segment of the array between the low & high indices on (threadCount) threads: the calling
+thread plus (threadCount - 1) worker threads, which all run parallelSortWorker() until the whole segment is sorted (join at the root).
+No thread is created after the start, so the sort never runs more threads than requested. With (parallelTop), the first levels are
+partitioned by all threads together (partitionTopLevels()) before the workers start, and the resulting sub-arrays are dealt out to the
+deques as the first tasks.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int threadCount - Number of threads, including the calling thread
+            int grain - Largest sub-array sorted sequentially (default 16384)
+            bool parallelTop - True to partition the first levels with all threads (default true)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSortParallel(int dataArray[], int low, int high, int threadCount, int grain = 16384, bool parallelTop = true)
+{
+    threadCount = (threadCount < 1) ? 1 : threadCount;
+
+    ParallelSortState state;
+    state.dataArray = dataArray;
+    state.grain = (grain < 1) ? 1 : grain;
+    for (int i = 0; i < threadCount; i++)
+    {
+        state.deques.push_back(unique_ptr<ChaseLevDeque>(new ChaseLevDeque()));
+    }
+
+    vector<WorkRange> ranges; // First tasks: the root, or the sub-arrays left by the parallel top levels
+    if (parallelTop && threadCount > 1)
+    {
+        partitionTopLevels(dataArray, low, high, threadCount, threadCount, ranges);
+    }
+    else
+    {
+        ranges.push_back({low, high});
+    }
+
+    for (size_t i = 0; i < ranges.size(); i++) // Deal the first tasks out to the deques (no worker is running yet)
+    {
+        state.pendingTasks++;
+        state.deques[i % threadCount]->push(ranges[i].low, ranges[i].high);
+    }
+
+    vector<thread> workers;
+    for (int i = 1; i < threadCount; i++)
+    {
+        workers.push_back(thread(parallelSortWorker, ref(state), i));
+    }
+
+    parallelSortWorker(state, 0); // The calling thread works too, and returns once every task has finished
+
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The SplitKernel type is a function that splits the sub-array [low] -> [high] in place into the elements less than the pivot value
+followed by the rest, and returns the index of the first element that is not less than the pivot. splitScalar() and the vectorized
+kernels below all have this signature, so partitionVectorized() can use any of them.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+typedef int (*SplitKernel)(int dataArray[], int low, int high, int pivot);
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The splitScalar() function is the scalar SplitKernel, a thin wrapper around partitionChunk().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+            int pivot - Pivot value
+    >> Return:
+            int - Index of the first element that is not less than the pivot
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int splitScalar(int dataArray[], int low, int high, int pivot)
+{
+    return low + partitionChunk(dataArray, low, high, pivot);
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SPLIT_KERNELS 1
+#include <immintrin.h> // AVX2 / AVX-512 intrinsics (compiled per function with target attributes, no -mavx2 flag needed)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized" // False positive on the _mm512_undefined_*() placeholders inside immintrin.h
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The SplitPermutations struct is the lookup table of splitAvx2(). AVX2 has no compress instruction, so for each of the 256 possible
+"less than the pivot" masks of 8 lanes, lanes[mask] is the permutation that moves the lesser lanes to the front & the other lanes to the
+back of the register (each group keeping its order). It is built once, on first use.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct SplitPermutations
+{
+    alignas(32) int lanes[256][8];
+
+    SplitPermutations()
+    {
+        for (int mask = 0; mask < 256; mask++)
+        {
+            int next = 0;
+            for (int lane = 0; lane < 8; lane++) // Lesser lanes first...
+            {
+                if (mask & (1 << lane))
+                {
+                    lanes[mask][next++] = lane;
+                }
+            }
+            for (int lane = 0; lane < 8; lane++) // ...then the rest
+            {
+                if (!(mask & (1 << lane)))
+                {
+                    lanes[mask][next++] = lane;
+                }
+            }
+        }
+    }
+};
+
+const SplitPermutations &splitPermutations()
+{
+    static const SplitPermutations table; // Thread-safe one-time initialisation
+    return table;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The splitAvx2() function is the AVX2 SplitKernel (the in-place vectorized partition of Bramas & x86-simd-sort). The first & last 8
+elements are held back in registers, which leaves 16 free slots to write into. Each step loads 8 unread elements from the side with less
+free space, compares them against the pivot at once, permutes the lesser lanes to the front (SplitPermutations), and stores the whole
+register at the left write position AND at the right write position: the lesser lanes land on the left, the other lanes on the right,
+and the extra lanes of each store only touch free slots that a later store overwrites. The held back registers are stored last.
+Sub-arrays of fewer than 16 elements are split with partitionChunk(), and (size % 8) elements are peeled off first with scalar code.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+            int pivot - Pivot value
+    >> Return:
+            int - Index of the first element that is not less than the pivot
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx2"))) int splitAvx2(int dataArray[], int low, int high, int pivot)
+{
+    const int W = 8; // Lanes per register
+    int left = low;       // Unread elements are [left] -> [right - 1]
+    int right = high + 1;
+
+    if (right - left < 2 * W)
+    {
+        return low + partitionChunk(dataArray, low, high, pivot);
+    }
+
+    for (int peel = (right - left) % W; peel > 0; peel--) // Leave a multiple of W unread elements
+    {
+        if (dataArray[left] < pivot)
+        {
+            left++;
+        }
+        else
+        {
+            swap(dataArray[left], dataArray[--right]);
+        }
+    }
+
+    const SplitPermutations &table = splitPermutations();
+    __m256i pivotVector = _mm256_set1_epi32(pivot);
+
+    // Store one register: lesser lanes at [leftStore], the other lanes ending at [rightStore + W - 1]
+    auto storeSplit = [&](__m256i values, int &leftStore, int &rightStore) __attribute__((target("avx2"))) {
+        int lessMask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivotVector, values)));
+        int lessCount = __builtin_popcount(lessMask);
+        __m256i permutation = _mm256_load_si256((const __m256i *)table.lanes[lessMask]);
+        __m256i split = _mm256_permutevar8x32_epi32(values, permutation);
+
+        _mm256_storeu_si256((__m256i *)(dataArray + leftStore), split);
+        _mm256_storeu_si256((__m256i *)(dataArray + rightStore), split);
+        leftStore += lessCount;
+        rightStore -= (W - lessCount);
+    };
+
+    __m256i heldFirst = _mm256_loadu_si256((const __m256i *)(dataArray + left)); // Held back -> 2 * W free slots
+    __m256i heldLast = _mm256_loadu_si256((const __m256i *)(dataArray + right - W));
+    int leftStore = left;       // Next lesser element goes to [leftStore]
+    int rightStore = right - W; // Next other elements end at [rightStore + W - 1]
+    left += W;
+    right -= W;
+
+    while (left < right)
+    {
+        __m256i values;
+        if ((rightStore + W) - right < left - leftStore) // Less free space on the right -> Read from the right
+        {
+            right -= W;
+            values = _mm256_loadu_si256((const __m256i *)(dataArray + right));
+        }
+        else
+        {
+            values = _mm256_loadu_si256((const __m256i *)(dataArray + left));
+            left += W;
+        }
+        storeSplit(values, leftStore, rightStore);
+    }
+
+    storeSplit(heldFirst, leftStore, rightStore);
+    storeSplit(heldLast, leftStore, rightStore);
+
+    return leftStore;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The splitAvx512() function is the AVX-512 SplitKernel. It works exactly like splitAvx2() with 16 lanes per register, but AVX-512 can
+compress-store the lesser lanes to the left & the other lanes to the right directly, so no permutation table is needed.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array
+            int high - Index of the last element in sub-array
+            int pivot - Pivot value
+    >> Return:
+            int - Index of the first element that is not less than the pivot
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx512f"))) int splitAvx512(int dataArray[], int low, int high, int pivot)
+{
+    const int W = 16; // Lanes per register
+    int left = low;
+    int right = high + 1;
+
+    if (right - left < 2 * W)
+    {
+        return low + partitionChunk(dataArray, low, high, pivot);
+    }
+
+    for (int peel = (right - left) % W; peel > 0; peel--)
+    {
+        if (dataArray[left] < pivot)
+        {
+            left++;
+        }
+        else
+        {
+            swap(dataArray[left], dataArray[--right]);
+        }
+    }
+
+    __m512i pivotVector = _mm512_set1_epi32(pivot);
+
+    auto storeSplit = [&](__m512i values, int &leftStore, int &rightStore) __attribute__((target("avx512f"))) {
+        __mmask16 lessMask = _mm512_cmplt_epi32_mask(values, pivotVector);
+        int lessCount = __builtin_popcount((unsigned int)lessMask);
+
+        _mm512_mask_compressstoreu_epi32(dataArray + leftStore, lessMask, values);
+        _mm512_mask_compressstoreu_epi32(dataArray + rightStore + lessCount, (__mmask16)~lessMask, values);
+        leftStore += lessCount;
+        rightStore -= (W - lessCount);
+    };
+
+    __m512i heldFirst = _mm512_loadu_si512((const void *)(dataArray + left));
+    __m512i heldLast = _mm512_loadu_si512((const void *)(dataArray + right - W));
+    int leftStore = left;
+    int rightStore = right - W;
+    left += W;
+    right -= W;
+
+    while (left < right)
+    {
+        __m512i values;
+        if ((rightStore + W) - right < left - leftStore)
+        {
+            right -= W;
+            values = _mm512_loadu_si512((const void *)(dataArray + right));
+        }
+        else
+        {
+            values = _mm512_loadu_si512((const void *)(dataArray + left));
+            left += W;
+        }
+        storeSplit(values, leftStore, rightStore);
+    }
+
+    storeSplit(heldFirst, leftStore, rightStore);
+    storeSplit(heldLast, leftStore, rightStore);
+
+    return leftStore;
+}
+
+#pragma GCC diagnostic pop
+#endif
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The selectSplitKernel() function returns the split kernel with the given name. "auto" picks the widest vector kernel the CPU supports at
+runtime (AVX-512, then AVX2), and falls back to the scalar kernel.
+    >> Parameters:
+            const string &name - auto | scalar | avx2 | avx512
+    >> Return:
+            SplitKernel - The selected kernel, or nullptr if the name is unknown or the CPU does not support it
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+SplitKernel selectSplitKernel(const string &name)
+{
+    if (name == "scalar")
+    {
+        return splitScalar;
+    }
+
+#ifdef HAVE_X86_SPLIT_KERNELS
+    __builtin_cpu_init();
+    bool hasAvx512 = __builtin_cpu_supports("avx512f");
+    bool hasAvx2 = __builtin_cpu_supports("avx2");
+
+    if (name == "avx512" || (name == "auto" && hasAvx512))
+    {
+        return hasAvx512 ? splitAvx512 : nullptr;
+    }
+    if (name == "avx2" || (name == "auto" && hasAvx2))
+    {
+        return hasAvx2 ? splitAvx2 : nullptr;
+    }
+#endif
+
+    return (name == "auto") ? splitScalar : nullptr;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The partitionVectorized() function is a drop-in alternative to partitionFunction(): it partitions the sub-array around the last element
+with the given SplitKernel, moves the pivot into its final position & returns that position, exactly like partitionFunction().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            SplitKernel kernel - Split kernel doing the work (see selectSplitKernel())
+    >> Return:
+            int pivotIndex - Index of the pivot element's new position
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int partitionVectorized(int dataArray[], int low, int high, SplitKernel kernel)
+{
+    int pivot = dataArray[high];
+
+    int pivotIndex = kernel(dataArray, low, (high - 1), pivot); // First element not less than the pivot
+    swap(dataArray[pivotIndex], dataArray[high]);               // Pivot between the two sides
+
+    return pivotIndex;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The quickSortVectorized() function recursively sorts the segment of the array between the low & high indices exactly like quickSort(),
+with partitionVectorized() in place of partitionFunction().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            SplitKernel kernel - Split kernel doing the work (see selectSplitKernel())
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void quickSortVectorized(int dataArray[], int low, int high, SplitKernel kernel)
+{
+    if (low < high) // If the dataArray segment has more than 1 element
+    {
+        int pivotIndex = partitionVectorized(dataArray, low, high, kernel);
+
+        quickSortVectorized(dataArray, low, (pivotIndex - 1), kernel);  // Recursive call for left partition
+        quickSortVectorized(dataArray, (pivotIndex + 1), high, kernel); // Recursive call for right partition
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the tuning knobs of the sorting engines, which can be set on the command line as option=value.
+    >> Members:
+            int cutoff - Largest partition size finished by insertionSort()
+            int seed - Seed of the random pivot policy
+            int threads - Number of threads used by the parallel engine (including the calling thread)
+            int grain - Largest sub-array sorted sequentially by the parallel engine
+            int ppart - 1 to partition the first levels of the parallel engine with all threads, 0 to partition them on one thread
+            string kernel - Name of the split kernel used by the simd engine (see selectSplitKernel())
+            string partition - Name of the partition scheme used by the recursive engine (see selectPartitionScheme())
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    int cutoff = 16;
+    int seed = 1;
+    int threads = (thread::hardware_concurrency() > 0) ? (int)thread::hardware_concurrency() : 1;
+    int grain = 16384;
+    int ppart = 1;
+    string kernel = "auto";
+    string partition = "branchy";
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the whole array with the named sorting engine.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            const EngineOptions &options - Tuning knobs of the engines
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize, const EngineOptions &options)
+{
+    if (engine == "recursive")
+    {
+        PartitionScheme partition = selectPartitionScheme(options.partition);
+        if (partition == nullptr)
+        {
+            return false; // Unknown partition scheme
+        }
+        quickSort(dataArray, 0, (arraySize - 1), partition);
+    }
+    else if (engine == "intro")
+    {
+        introSort(dataArray, 0, (arraySize - 1), options.cutoff);
+    }
+    else if (engine == "bounded")
+    {
+        quickSortBounded(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "simd")
+    {
+        SplitKernel kernel = selectSplitKernel(options.kernel);
+        if (kernel == nullptr)
+        {
+            return false; // Unknown kernel, or not supported by this CPU
+        }
+        quickSortVectorized(dataArray, 0, (arraySize - 1), kernel);
+    }
+    else if (engine == "parallel")
+    {
+        quickSortParallel(dataArray, 0, (arraySize - 1), options.threads, options.grain, (options.ppart != 0));
+    }
+    else if (engine == "threeway")
+    {
+        quickSortThreeWay(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "last")
+    {
+        quickSortWithPolicy<PivotLast>(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "median3")
+    {
+        quickSortWithPolicy<PivotMedianOf3>(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "ninther")
+    {
+        quickSortWithPolicy<PivotNinther>(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "random")
+    {
+        PivotRandom::seed(options.seed); // Same seed -> Same pivots -> Reproducible run
+        quickSortWithPolicy<PivotRandom>(dataArray, 0, (arraySize - 1));
+    }
+    else if (engine == "mom")
+    {
+        quickSortWithPolicy<PivotMedianOfMedians>(dataArray, 0, (arraySize - 1));
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The hasBoundedDepth() function reports whether the named engine is safe from O(n) recursion depth on the given input pattern. Engines
+that are not are only benchmarked on inputs that are small enough not to overflow the call stack.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const string &pattern - Name of the input pattern (see generateInput())
+    >> Return:
+            bool - True if the engine's stack depth stays small on this pattern
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool hasBoundedDepth(const string &engine, const string &pattern)
+{
+    if (pattern == "random" || engine == "intro")
+    {
+        return true; // O(log(n)) expected depth on random input, O(log(n)) guaranteed depth for IntroSort
+    }
+
+    // simd partitions exactly like recursive. bounded & parallel keep their stacks small, but peel off one element per partition on
+    // the same patterns as recursive (O(n^2) time)
+
+    return engine == "threeway" && pattern == "fewunique"; // One recursion level per distinct value
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Tuning knobs of the engines to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    int value = atoi(argument.c_str() + separator + 1);
+
+    if (name == "kernel")
+    {
+        options.kernel = argument.substr(separator + 1);
+    }
+    else if (name == "partition")
+    {
+        options.partition = argument.substr(separator + 1);
+    }
+    else if (name == "cutoff")
+    {
+        options.cutoff = value;
+    }
+    else if (name == "seed")
+    {
+        options.seed = value;
+    }
+    else if (name == "threads")
+    {
+        options.threads = value;
+    }
+    else if (name == "grain")
+    {
+        options.grain = value;
+    }
+    else if (name == "ppart")
+    {
+        options.ppart = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The generateInput() function builds a benchmark input of the given shape from a fixed seed, so every run sorts the same data.
+    >> Parameters:
+            const string &pattern - random | sorted | reversed | organpipe (ascending then descending) | fewunique (values 0 -> 3)
+            int arraySize - Number of integers to generate
+    >> Return:
+            vector<int> - The generated input
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+vector<int> generateInput(const string &pattern, int arraySize)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+    uniform_int_distribution<int> fewValues(0, 3);
+
+    vector<int> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        if (pattern == "sorted")
+        {
+            input[i] = i;
+        }
+        else if (pattern == "reversed")
+        {
+            input[i] = arraySize - i;
+        }
+        else if (pattern == "organpipe")
+        {
+            input[i] = (i < arraySize / 2) ? i : (arraySize - i);
+        }
+        else if (pattern == "fewunique")
+        {
+            input[i] = fewValues(generator);
+        }
+        else
+        {
+            input[i] = distribution(generator);
+        }
+    }
+
+    return input;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named sorting engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            const EngineOptions &options - Tuning knobs of the engines
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, const EngineOptions &options, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size(), options);
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+const int UNBOUNDED_BENCH_LIMIT = 20000; // Largest adversarial input given to an engine with O(n) worst-case recursion depth
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times every sorting engine on the same generated inputs (random & adversarial), and checks every output
+against std::sort(). Engines without a bounded recursion depth are skipped on adversarial inputs larger than UNBOUNDED_BENCH_LIMIT.
+    >> Parameters:
+            int arraySize - Number of integers to sort
+            const EngineOptions &options - Tuning knobs of the engines
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize, const EngineOptions &options)
+{
+    const char *engines[] = {"recursive", "bounded", "parallel", "simd", "intro", "threeway"};
+    const char *patterns[] = {"random", "sorted", "reversed", "organpipe", "fewunique"};
+
+    cout << endl
+         << "Benchmark: " << arraySize << " integers (ms)" << endl
+         << "   " << left << setw(12) << "engine" << right;
+    for (const char *pattern : patterns)
+    {
+        cout << setw(12) << pattern;
+    }
+    cout << endl;
+
+    vector<vector<int>> inputs;
+    vector<vector<int>> expected;
+    for (const char *pattern : patterns)
+    {
+        inputs.push_back(generateInput(pattern, arraySize));
+        expected.push_back(inputs.back());
+        sort(expected.back().begin(), expected.back().end()); // Reference output
+    }
+
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with the reference output
+
+    for (const char *engine : engines)
+    {
+        cout << "   " << left << setw(12) << engine << right;
+
+        for (size_t p = 0; p < inputs.size(); p++)
+        {
+            if (!hasBoundedDepth(engine, patterns[p]) && arraySize > UNBOUNDED_BENCH_LIMIT)
+            {
+                cout << setw(12) << "skipped"; // Could overflow the call stack
+                continue;
+            }
+
+            double milliseconds = timeEngine(engine, inputs[p], options, output);
+            allMatch = allMatch && (output == expected[p]);
+
+            cout << setw(12) << fixed << setprecision(2) << milliseconds;
+        }
+        cout << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+
+    cout << endl
+         << "Parallel scaling (random, grain=" << options.grain << "):" << endl;
+
+    vector<int> threadCounts; // 1, 2, 4, ... up to (and including) options.threads
+    for (int threads = 1; threads < options.threads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back((options.threads > 1) ? options.threads : 1);
+
+    double oneThread = 0.0; // Time of the 1-thread run, the baseline of the speedup columns
+
+    cout << "   " << left << setw(16) << "" << right << setw(22) << "serial top (ppart=0)" << setw(24) << "parallel top (ppart=1)"
+         << endl;
+    for (int threads : threadCounts)
+    {
+        EngineOptions scalingOptions = options;
+        scalingOptions.threads = threads;
+
+        scalingOptions.ppart = 0;
+        double serialTop = timeEngine("parallel", inputs[0], scalingOptions, output);
+        bool match = (output == expected[0]);
+
+        scalingOptions.ppart = 1;
+        double parallelTop = timeEngine("parallel", inputs[0], scalingOptions, output);
+        match = match && (output == expected[0]);
+
+        if (threads == 1)
+        {
+            oneThread = serialTop;
+        }
+
+        cout << "   threads=" << left << setw(7) << threads << right << setw(10) << fixed << setprecision(2) << serialTop << " ms"
+             << setw(8) << setprecision(2) << (oneThread / serialTop) << "x" << setw(12) << parallelTop << " ms" << setw(8)
+             << (oneThread / parallelTop) << "x" << (match ? "   OK" : "   MISMATCH") << endl;
+    }
+
+    // Split kernels: one top-level partitionVectorized() of the random input, then a whole sort checked against the scalar kernel
+    cout << endl
+         << "Split kernels (random):" << endl
+         << "   " << left << setw(12) << "kernel" << right << setw(16) << "partition GB/s" << setw(14) << "sort ms" << endl;
+
+    vector<int> scalarOutput;
+    const char *kernels[] = {"scalar", "avx2", "avx512"};
+    for (const char *name : kernels)
+    {
+        SplitKernel kernel = selectSplitKernel(name);
+        if (kernel == nullptr)
+        {
+            cout << "   " << left << setw(12) << name << right << "   not supported by this CPU" << endl;
+            continue;
+        }
+
+        output = inputs[0];
+        auto start = chrono::steady_clock::now();
+        partitionVectorized(output.data(), 0, (arraySize - 1), kernel);
+        auto stop = chrono::steady_clock::now();
+        double seconds = chrono::duration<double>(stop - start).count();
+        double gigabytes = 2.0 * arraySize * sizeof(int) / 1e9; // Every element read & written once
+
+        EngineOptions kernelOptions = options;
+        kernelOptions.kernel = name;
+        double milliseconds = timeEngine("simd", inputs[0], kernelOptions, output);
+        if (scalarOutput.empty())
+        {
+            scalarOutput = output;
+        }
+
+        cout << "   " << left << setw(12) << name << right << setw(16) << fixed << setprecision(2) << (gigabytes / seconds) << setw(14)
+             << milliseconds << ((output == scalarOutput && output == expected[0]) ? "   identical" : "   MISMATCH") << endl;
+    }
+
+    // Partition schemes: one top-level partition of the random input, then a whole sort (same pivots -> same boundaries)
+    cout << endl
+         << "Partition schemes (random):" << endl
+         << "   " << left << setw(12) << "partition" << right << setw(16) << "partition ms" << setw(14) << "sort ms" << setw(12)
+         << "speedup" << endl;
+
+    double branchySort = 0.0; // Sort time of the branchy scheme, the baseline of the speedup column
+    const char *schemes[] = {"branchy", "branchless", "cyclic"};
+    for (const char *name : schemes)
+    {
+        PartitionScheme partition = selectPartitionScheme(name);
+
+        output = inputs[0];
+        auto start = chrono::steady_clock::now();
+        partition(output.data(), 0, (arraySize - 1));
+        auto stop = chrono::steady_clock::now();
+        double partitionMilliseconds = chrono::duration<double, milli>(stop - start).count();
+
+        EngineOptions schemeOptions = options;
+        schemeOptions.partition = name;
+        double milliseconds = timeEngine("recursive", inputs[0], schemeOptions, output);
+        if (branchySort == 0.0)
+        {
+            branchySort = milliseconds;
+        }
+
+        cout << "   " << left << setw(12) << name << right << setw(16) << fixed << setprecision(2) << partitionMilliseconds << setw(14)
+             << milliseconds << setw(11) << (branchySort / milliseconds) << "x"
+             << ((output == expected[0]) ? "   OK" : "   MISMATCH") << endl;
+    }
+
+    // Pivot policies are compared at a size where even the quadratic cases finish quickly (and cannot overflow the call stack)
+    int policySize = (arraySize < UNBOUNDED_BENCH_LIMIT) ? arraySize : UNBOUNDED_BENCH_LIMIT;
+    const char *policies[] = {"last", "median3", "ninther", "random", "mom"};
+
+    cout << endl
+         << "Pivot policies: " << policySize << " integers (ms)" << endl
+         << "   " << left << setw(12) << "policy" << right;
+    for (const char *pattern : patterns)
+    {
+        cout << setw(12) << pattern;
+    }
+    cout << endl;
+
+    for (size_t p = 0; p < inputs.size(); p++)
+    {
+        inputs[p] = generateInput(patterns[p], policySize);
+        expected[p] = inputs[p];
+        sort(expected[p].begin(), expected[p].end());
+    }
+
+    allMatch = true;
+    for (const char *policy : policies)
+    {
+        cout << "   " << left << setw(12) << policy << right;
+
+        for (size_t p = 0; p < inputs.size(); p++)
+        {
+            double milliseconds = timeEngine(policy, inputs[p], options, output);
+            allMatch = allMatch && (output == expected[p]);
+
+            cout << setw(12) << fixed << setprecision(2) << milliseconds;
+        }
+        cout << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+
+    // The work stack of quickSortBounded() stays within log2(n) entries even where the partitions are as unbalanced as they get
+    int log2Size = 0;
+    for (int size = policySize; size > 1; size /= 2)
+    {
+        log2Size++;
+    }
+
+    cout << endl
+         << "Work stack depth (bounded): " << policySize << " integers, log2(n) = " << log2Size << endl
+         << "   " << left << setw(12) << "" << right;
+    for (const char *pattern : patterns)
+    {
+        cout << setw(12) << pattern;
+    }
+    cout << endl
+         << "   " << left << setw(12) << "max depth" << right;
+
+    allMatch = true;
+    for (size_t p = 0; p < inputs.size(); p++)
+    {
+        output = inputs[p];
+        int maxDepth = quickSortBounded(output.data(), 0, (policySize - 1));
+        allMatch = allMatch && (output == expected[p]);
+
+        cout << setw(12) << maxDepth;
+    }
+    cout << endl
+         << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
+terminal before and after the QuickSort algorithm is performed.
+    >> Arguments:
+            argv[1] - Sorting engine to run: recursive (default) | bounded | parallel | simd | intro |
+                      threeway | last | median3 | ninther | random | mom | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 1000000)
+            argv[3...] - Engine options of the form option=value (cutoff=16, seed=1, threads=N, grain=16384, ppart=1,
+                         kernel=auto, partition=branchy)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "recursive"; // Sorting engine selected on the command line
+    EngineOptions options;                              // Tuning knobs selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000, options);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Running QuickSort - Lomuto's Partitioning Scheme (" << engine << ")..." << endl;
+    // Call the selected QuickSort engine to sort the array
+    if (!sortWithEngine(engine, dataArray, arraySize, options))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
 
     // Print the sorted array
     cout << endl
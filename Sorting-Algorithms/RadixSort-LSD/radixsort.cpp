@@ -0,0 +1,628 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> RADIXSORT - LEAST SIGNIFICANT DIGIT (LSD) <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This radixsort.cpp file is a personal reference of the LSD RadixSort algorithm for 32-bit signed integers. Unlike QuickSort, MergeSort
+& InsertionSort, RadixSort never compares two elements: every integer is split into digits of (b) bits, and the array is distributed by
+one digit at a time, from the least significant digit to the most significant digit. Each distribution is a stable counting sort, so
+the order established by the lower digits is kept for equal higher digits, and the array is sorted once the most significant digit has
+been distributed. The running time grows linearly with (n), which beats the n*log(n) comparison sorts on large arrays.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> RadixSort (LSD): Accepts a pointer to an array & its size. The integers are turned into unsigned keys (sign-bit flip), the counts of
+        every digit of every pass are gathered in one read of the array, and each pass then scatters the elements from the source array
+        into the destination buffer at the positions given by the prefix sums of its counts. Source & destination swap roles after
+        every pass (ping-pong), and the result is copied back into the array if it ends in the buffer.
+
+>> Sign-Bit Flip: Two's complement integers do not sort as unsigned digits, because negative integers have their highest bit set and
+        would land after the positive integers. Flipping the sign bit (key = value ^ 0x80000000) maps INT_MIN -> 0, -1 -> 0x7FFFFFFF,
+        0 -> 0x80000000 & INT_MAX -> 0xFFFFFFFF, so the unsigned order of the keys is the signed order of the integers. The flip is
+        applied when a digit is extracted, the array itself always holds the original integers.
+
+>> Digit Size: 8-bit digits take 4 passes with 256 counters each. 11-bit digits take only 3 passes (11 + 11 + 10 bits), but with 2048
+        counters, whose destinations no longer fit in the L1 cache. Which one is faster depends on (n) & the cache sizes (digits=8 | 11).
+
+>> One-Pass Histograms: The counts of a pass do not depend on the order of the elements, so the counts of all passes are gathered in a
+        single read of the array before the first pass, instead of one extra read per pass.
+
+>> Skipped Passes: If every key has the same digit in a pass (e.g. the upper bytes of small non-negative integers), the pass would copy
+        the array unchanged. This shows in the counts (one digit counts all (n) elements), and such passes are skipped.
+
+>> Write-Combining Scatter: The scatter writes to 256 (or 2048) places in the destination at once, one element at a time, so almost
+        every store touches a different cache line (and TLB page). With write combining (wc=1), each digit first collects its elements
+        in a small buffer of one cache line (16 integers), and a full line is copied to the destination at once. The first line of every
+        digit is cut short at the next 64-byte boundary of the destination, so every later copy fills exactly one aligned cache line.
+        The buffers of all digits stay in the L1/L2 cache, and the destination is written in whole cache lines. The extra copy through
+        the line is not free: when the direct stores already hit the cache, the direct scatter (wc=0) can be faster, so the benchmark
+        engine times both.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Stable Algorithm: RadixSort (LSD) is a stable algorithm, meaning that elements with equal values will always retain their relative
+                     order in the sorted array.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        All-cases: O(w/b * (n + 2^b)) - (w/b) passes of (b) bits over keys of (w = 32) bits, each pass scattering (n) elements & summing
+                                        (2^b) counters. With (w) & (b) fixed, this is linear in (n).
+                                           O(n + 2^b) - One pass, n = # elements in array, 2^b = # of digit values
+                                            * (for-each)
+                                           O(w/b) - Number of passes (4 for 8-bit digits, 3 for 11-bit digits)
+                                            = O(n)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        All-cases: O(n + 2^b) - One (n) sized destination buffer for the ping-pong passes, the counters of every pass, and one cache line
+                                per digit for write combining.
+                                   O(n) - Destination buffer, n = # elements in array
+                                    + (plus)
+                                   O(2^b) - Counters & write-combining lines, 2^b = # of digit values
+                                    = O(n)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example RadixSort Execution (8-bit digits, keys in hexadecimal):
+        Key: {} = Array, [] = Digit of the current pass
+        Array = {23, -1, 10, 5, 2};
+        Keys (sign bit flipped) = {80000017, 7FFFFFFF, 8000000A, 80000005, 80000002}
+
+            (1) Pass 1 (bits 0 -> 7): Digits [17], [FF], [0A], [05], [02]
+                   ⮕ {2, 5, 10, 23, -1}
+            (2) Pass 2 (bits 8 -> 15): Digits [00], [00], [00], [00], [FF] -> Stable, the order of equal digits is kept
+                   ⮕ {2, 5, 10, 23, -1}
+            (3) Pass 3 (bits 16 -> 23): Digits [00], [00], [00], [00], [FF]
+                   ⮕ {2, 5, 10, 23, -1}
+            (4) Pass 4 (bits 24 -> 31): Digits [80], [80], [80], [80], [7F] -> The negative integer moves to the front
+                   ⮕ {-1, 2, 5, 10, 23}
+
+        * SORTED: arr[] = {-1, 2, 5, 10, 23}
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ radixsort.cpp || g++ radixsort.cpp -g -o radixsort
+        ./a.out || valgrind ./a.out || valgrind ./radixsort || valgrind --leak-check=full ./radixsort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = lsd (default) | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 1000000)
+            options = digits=8 (digit size in bits: 8 | 11)
+                      wc=1 (write-combining scatter, 0 = scatter directly)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <cstdint>   // uintptr_t
+#include <cstring>   // memcpy
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort
+
+using namespace std;
+
+const int WC_LINE = 16; // Integers per write-combining line (one 64-byte cache line)
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The CombiningLine struct is the write-combining buffer of one digit, aligned to a cache line.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct alignas(64) CombiningLine
+{
+    int elements[WC_LINE];
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The digitOf() function extracts one digit of the unsigned key of an integer (sign bit flipped, see the header).
+    >> Parameters:
+            int value - Integer
+            int shift - Position of the lowest bit of the digit
+            unsigned mask - (2^b - 1), b = digit size in bits
+    >> Return:
+            unsigned - The digit (0 -> 2^b - 1)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+inline unsigned digitOf(int value, int shift, unsigned mask)
+{
+    return (((unsigned)value ^ 0x80000000u) >> shift) & mask;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The scatterDirect() function distributes the source array into the destination by one digit, writing every element straight to its
+position.
+    >> Parameters:
+            const int source[] - Elements to be distributed
+            int destination[] - Receives the distributed elements
+            int arraySize - Number of elements
+            int offsets[] - Starting position of every digit (advanced as elements are written)
+            int shift - Position of the lowest bit of the digit
+            unsigned mask - (2^b - 1), b = digit size in bits
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void scatterDirect(const int source[], int destination[], int arraySize, int offsets[], int shift, unsigned mask)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        int value = source[i];
+        destination[offsets[digitOf(value, shift, mask)]++] = value;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The scatterCombined() function distributes the source array into the destination by one digit through write-combining lines: every
+element is appended to the line of its digit, and a full line is copied to the destination in one piece. The first line of every digit
+only holds the elements up to the next 64-byte boundary of the destination, so every later line fills exactly one aligned cache line of
+the destination. The partly filled lines are flushed at the end.
+    >> Parameters:
+            const int source[] - Elements to be distributed
+            int destination[] - Receives the distributed elements
+            int arraySize - Number of elements
+            int offsets[] - Starting position of every digit (advanced as lines are flushed)
+            int shift - Position of the lowest bit of the digit
+            unsigned mask - (2^b - 1), b = digit size in bits
+            CombiningLine lines[] - One line per digit
+            int fill[] - Number of elements in every line (all 0 on entry & on return)
+            int limit[] - Capacity of the current line of every digit (set here)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void scatterCombined(const int source[], int destination[], int arraySize, int offsets[], int shift, unsigned mask,
+                     CombiningLine lines[], int fill[], int limit[])
+{
+    for (unsigned digit = 0; digit <= mask; digit++) // First line of every digit -> Up to the next 64-byte boundary
+    {
+        limit[digit] = WC_LINE - (int)(((uintptr_t)(destination + offsets[digit]) / sizeof(int)) % WC_LINE);
+    }
+
+    for (int i = 0; i < arraySize; i++)
+    {
+        int value = source[i];
+        unsigned digit = digitOf(value, shift, mask);
+
+        lines[digit].elements[fill[digit]++] = value;
+        if (fill[digit] == limit[digit]) // Line full -> One copy up to the next 64-byte boundary of the destination
+        {
+            memcpy(destination + offsets[digit], lines[digit].elements, (size_t)fill[digit] * sizeof(int));
+            offsets[digit] += fill[digit];
+            fill[digit] = 0;
+            limit[digit] = WC_LINE; // Aligned from now on -> Whole cache lines
+        }
+    }
+
+    for (unsigned digit = 0; digit <= mask; digit++) // Flush the partly filled lines
+    {
+        memcpy(destination + offsets[digit], lines[digit].elements, (size_t)fill[digit] * sizeof(int));
+        offsets[digit] += fill[digit];
+        fill[digit] = 0;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The radixSort() function sorts the array with LSD RadixSort: it counts the digits of all passes in one read of the array, skips the
+passes where every key has the same digit, and scatters the remaining passes between the array & one buffer (ping-pong).
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int digitBits - Digit size in bits (8 or 11, other values are clamped to 1 -> 16)
+            bool writeCombining - True to scatter through write-combining lines (scatterCombined())
+    >> Return:
+            int - Number of passes performed (the others were skipped)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int radixSort(int dataArray[], int arraySize, int digitBits = 8, bool writeCombining = true)
+{
+    if (arraySize < 2)
+    {
+        return 0; // Already sorted
+    }
+
+    digitBits = (digitBits < 1) ? 1 : ((digitBits > 16) ? 16 : digitBits);
+    int radix = 1 << digitBits;                    // Number of digit values
+    unsigned mask = (unsigned)radix - 1;           // Digit mask
+    int passes = (32 + digitBits - 1) / digitBits; // Number of digits in a 32-bit key
+
+    vector<int> counts((size_t)passes * radix, 0); // counts[pass * radix + digit]
+    for (int i = 0; i < arraySize; i++)             // One read of the array for the counts of every pass
+    {
+        for (int pass = 0; pass < passes; pass++)
+        {
+            counts[(size_t)pass * radix + digitOf(dataArray[i], pass * digitBits, mask)]++;
+        }
+    }
+
+    vector<int> buffer(arraySize);
+    vector<CombiningLine> lines(writeCombining ? radix : 0);
+    vector<int> fill(writeCombining ? radix : 0, 0);
+    vector<int> limit(writeCombining ? radix : 0, 0);
+
+    int *source = dataArray;
+    int *destination = buffer.data();
+    int performed = 0;
+
+    for (int pass = 0; pass < passes; pass++)
+    {
+        int shift = pass * digitBits;
+        int *offsets = &counts[(size_t)pass * radix];
+
+        if (offsets[digitOf(source[0], shift, mask)] == arraySize) // Every key has the same digit -> Nothing would move
+        {
+            continue;
+        }
+
+        int sum = 0; // Exclusive prefix sum: counts -> Starting position of every digit
+        for (int digit = 0; digit < radix; digit++)
+        {
+            int count = offsets[digit];
+            offsets[digit] = sum;
+            sum += count;
+        }
+
+        if (writeCombining)
+        {
+            scatterCombined(source, destination, arraySize, offsets, shift, mask, lines.data(), fill.data(), limit.data());
+        }
+        else
+        {
+            scatterDirect(source, destination, arraySize, offsets, shift, mask);
+        }
+
+        int *temp = source; // Ping-pong: The destination of this pass is the source of the next pass
+        source = destination;
+        destination = temp;
+        performed++;
+    }
+
+    if (source != dataArray) // Odd number of passes -> The result is in the buffer
+    {
+        memcpy(dataArray, source, (size_t)arraySize * sizeof(int));
+    }
+
+    return performed;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the tuning knobs of the sorting engine, which can be set on the command line as option=value.
+    >> Members:
+            int digits - Digit size in bits (8 | 11)
+            int wc - 1 to scatter through write-combining lines, 0 to scatter directly
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    int digits = 8;
+    int wc = 1;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the whole array with the named sorting engine.
+    >> Parameters:
+            const string &engine - lsd (radixSort()) | std (std::sort(), the reference of the benchmark)
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            const EngineOptions &options - Tuning knobs of the engine
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize, const EngineOptions &options)
+{
+    if (engine == "lsd")
+    {
+        radixSort(dataArray, arraySize, options.digits, (options.wc != 0));
+    }
+    else if (engine == "std")
+    {
+        sort(dataArray, dataArray + arraySize);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Tuning knobs of the engine to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    int value = atoi(argument.c_str() + separator + 1);
+
+    if (name == "digits" && (value == 8 || value == 11))
+    {
+        options.digits = value;
+    }
+    else if (name == "wc")
+    {
+        options.wc = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The generateInput() function builds a benchmark input from a fixed seed, so every run sorts the same data: wide random integers, on
+which every pass is needed, or values 0 -> 3, on which every pass but the lowest digit's is skipped.
+    >> Parameters:
+            const string &pattern - random | fewunique (values 0 -> 3)
+            int arraySize - Number of integers to generate
+    >> Return:
+            vector<int> - The generated input
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+vector<int> generateInput(const string &pattern, int arraySize)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution((pattern == "fewunique") ? 0 : -1000000, (pattern == "fewunique") ? 3 : 1000000);
+
+    vector<int> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        input[i] = distribution(generator);
+    }
+
+    return input;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named sorting engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            const EngineOptions &options - Tuning knobs of the engine
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, const EngineOptions &options, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size(), options);
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times every digit size & scatter mode of radixSort() against std::sort() on wide & narrow random inputs,
+and checks every output against std::sort(). It then prints how many passes each configuration performed on each input.
+    >> Parameters:
+            int arraySize - Number of integers to sort
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize)
+{
+    const char *patterns[] = {"random", "fewunique"};
+    const char *names[] = {"std::sort", "lsd 8 wc", "lsd 8", "lsd 11 wc", "lsd 11"};
+    const int digits[] = {0, 8, 8, 11, 11}; // 0 = std::sort
+    const int wc[] = {0, 1, 0, 1, 0};
+
+    cout << endl
+         << "Benchmark: " << arraySize << " integers (ms)" << endl
+         << "   " << left << setw(12) << "engine" << right;
+    for (const char *pattern : patterns)
+    {
+        cout << setw(12) << pattern;
+    }
+    cout << endl;
+
+    vector<vector<int>> inputs;
+    vector<vector<int>> expected;
+    for (const char *pattern : patterns)
+    {
+        inputs.push_back(generateInput(pattern, arraySize));
+        expected.push_back(inputs.back());
+        sort(expected.back().begin(), expected.back().end()); // Reference output
+    }
+
+    vector<int> output;
+    bool allMatch = true; // True while every engine agrees with the reference output
+
+    for (int e = 0; e < 5; e++)
+    {
+        EngineOptions options;
+        options.digits = digits[e];
+        options.wc = wc[e];
+
+        cout << "   " << left << setw(12) << names[e] << right;
+
+        for (size_t p = 0; p < inputs.size(); p++)
+        {
+            double milliseconds = timeEngine((digits[e] == 0) ? "std" : "lsd", inputs[p], options, output);
+            allMatch = allMatch && (output == expected[p]);
+
+            cout << setw(12) << fixed << setprecision(2) << milliseconds;
+        }
+        cout << endl;
+    }
+    cout << "   Output check: " << (allMatch ? "OK" : "MISMATCH") << endl;
+
+    cout << endl
+         << "Passes performed (others skipped):" << endl
+         << "   " << left << setw(12) << "digits" << right;
+    for (const char *pattern : patterns)
+    {
+        cout << setw(12) << pattern;
+    }
+    cout << endl;
+
+    for (int digitBits : {8, 11})
+    {
+        cout << "   " << left << setw(12) << digitBits << right;
+        for (size_t p = 0; p < inputs.size(); p++)
+        {
+            output = inputs[p];
+            int performed = radixSort(output.data(), arraySize, digitBits);
+            cout << setw(8) << performed << " of " << ((32 + digitBits - 1) / digitBits);
+        }
+        cout << endl;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
+terminal before and after the RadixSort algorithm is performed.
+    >> Arguments:
+            argv[1] - Sorting engine to run: lsd (default) | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 1000000)
+            argv[3...] - Engine options of the form option=value (digits=8, wc=1)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "lsd"; // Sorting engine selected on the command line
+    EngineOptions options;                        // Tuning knobs selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Running RadixSort - LSD (" << engine << ")..." << endl;
+    // Call the selected RadixSort engine to sort the array
+    if (!sortWithEngine(engine, dataArray, arraySize, options))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    // Print the sorted array
+    cout << endl
+         << "Array after sorting:";
+    printArray(dataArray, arraySize);
+    cout << endl;
+
+    return 0;
+}
@@ -0,0 +1,513 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> RADIXSORT - MOST SIGNIFICANT DIGIT (MSD), IN PLACE (AMERICAN FLAG SORT) <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This radixsort.cpp file is a personal reference of the in-place MSD RadixSort algorithm (American flag sort) for 32-bit signed integers.
+LSD RadixSort (see RadixSort-LSD/radixsort.cpp) distributes the array into an (n) sized buffer on every pass, which doubles the memory
+footprint of very large arrays. MSD RadixSort starts at the most significant 8-bit digit instead: it permutes the array in place into
+256 buckets by that digit, and then sorts every bucket by the next digit, recursively. Only the counters of each level are needed, and
+small buckets are finished with InsertionSort.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> RadixSort (MSD, American Flag): Accepts a pointer to an array, along with the low & high indices of the sub-array to be sorted, and
+        the position of the digit to sort by (starting with bits 24 -> 31). The digits of the sub-array are counted, and the prefix sums
+        of the counts give every bucket its range. The elements are then permuted into their buckets in place (see Cycle-Leader Swaps),
+        and every bucket with more than one element is sorted recursively by the next lower digit. Sub-arrays of (cutoff) or fewer
+        elements are sorted with InsertionSort, since the 256 counters of a level cost more than sorting a handful of elements. Levels
+        where every element has the same digit (e.g. the upper bytes of small integers) are skipped without moving anything.
+
+>> Cycle-Leader Swaps: Every bucket keeps a head, the first position that does not hold one of its elements yet. Starting at the head of
+        bucket (d), the element found there is moved to the head of the bucket its digit belongs to (which advances that head), and the
+        element it displaces continues the cycle, until an element with digit (d) comes back & fills the starting position. Every element
+        is moved at most once to its final bucket, and no buffer is needed.
+
+>> Sign-Bit Flip: Two's complement integers do not sort as unsigned digits, because negative integers have their highest bit set and
+        would land after the positive integers. Flipping the sign bit (key = value ^ 0x80000000) maps INT_MIN -> 0, -1 -> 0x7FFFFFFF,
+        0 -> 0x80000000 & INT_MAX -> 0xFFFFFFFF, so the unsigned order of the keys is the signed order of the integers.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Unstable Algorithm: RadixSort (MSD, American Flag) is an unstable algorithm, meaning that elements with equal values are not
+                       guaranteed to retain their relative order in the sorted array (the cycles move elements past each other).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        All-cases: O(w/b * n) - Every level of the recursion counts & permutes each of its elements once, and an element passes through
+                                at most (w/b = 4) levels, one per 8-bit digit of a 32-bit key. Small buckets end early with
+                                InsertionSort, which costs O(cutoff) per element at most.
+                                   O(n) - Counting & permuting one level, n = # elements in array
+                                    * (for-each)
+                                   O(w/b) - Levels of the recursion (4 for 8-bit digits)
+                                    = O(n)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        All-cases: O(w/b * 2^b) - Each level keeps 256 counters, heads & tails (3 KB) on the call stack, and the recursion is at most
+                                  (w/b = 4) levels deep. That is a fixed ~12 KB, no matter how large the array is.
+                                     O(2^b) - Counters, heads & tails of one level, 2^b = # of digit values
+                                      * (for-each)
+                                     O(w/b) - Levels of the recursion
+                                      = O(1)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Example RadixSort Execution (8-bit digits, keys in hexadecimal, cutoff ignored):
+        Key: {} = Array, [] = Digit of the current level, (+) = Element moved into its bucket
+        Array = {23, -1, 10, 5, 2};
+        Keys (sign bit flipped) = {80000017, 7FFFFFFF, 8000000A, 80000005, 80000002}
+
+            (1) Level 1 (bits 24 -> 31): Digits [80], [7F], [80], [80], [80] -> Bucket [7F] = [0], Bucket [80] = [1] -> [4]
+                   (+) 23 [80] moved to head of [80] = [1], displaces -1 [7F]
+                   (+) -1 [7F] moved to head of [7F] = [0] -> Cycle closed
+                   ⮕ {-1, 23, 10, 5, 2} -> Recurse on Bucket [80] = [1] -> [4]
+            (2) Level 2 (bits 16 -> 23) & Level 3 (bits 8 -> 15): Every digit is [00] -> Skipped
+            (3) Level 4 (bits 0 -> 7): Digits [17], [0A], [05], [02] -> Buckets [02] = [1], [05] = [2], [0A] = [3], [17] = [4]
+                   (+) 23 [17] moved to [4], displaces 2 [02] -> 2 moved to [1] -> Cycle closed
+                   (+) 10 [0A] moved to [3], displaces 5 [05] -> 5 moved to [2] -> Cycle closed
+                   ⮕ {-1, 2, 5, 10, 23}
+
+        * SORTED: arr[] = {-1, 2, 5, 10, 23}
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ radixsort.cpp || g++ radixsort.cpp -g -o radixsort
+        ./a.out || valgrind ./a.out || valgrind ./radixsort || valgrind --leak-check=full ./radixsort
+        ./a.out [engine] [dataFile] [option=value ...]
+            engine = msd (default) | bench
+            dataFile = data1.txt (default), or the number of random integers to sort when benchmarking (default 1000000, try 100000000)
+            options = cutoff=32 (largest bucket sorted by InsertionSort)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>  // cout
+#include <fstream>   // ifstream
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <cstdlib>   // atoi
+#include <vector>    // vector
+#include <random>    // mt19937, uniform_int_distribution
+#include <chrono>    // steady_clock
+#include <iomanip>   // setw, setprecision
+#include <algorithm> // sort
+
+using namespace std;
+
+const int DIGIT_BITS = 8;              // Bits per digit
+const int RADIX = 1 << DIGIT_BITS;     // Buckets per level
+const int TOP_SHIFT = 32 - DIGIT_BITS; // Position of the most significant digit
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The digitOf() function extracts one 8-bit digit of the unsigned key of an integer (sign bit flipped, see the header).
+    >> Parameters:
+            int value - Integer
+            int shift - Position of the lowest bit of the digit (24, 16, 8 or 0)
+    >> Return:
+            int - The digit (0 -> 255)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+inline int digitOf(int value, int shift)
+{
+    return (int)((((unsigned)value ^ 0x80000000u) >> shift) & (RADIX - 1));
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSort() function sorts the sub-array bounded by [low] & [high] in place. This is the InsertionSort kernel from
+InsertionSort/insertionsort.cpp, restricted to a range so that it can sort the small buckets.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSort(int dataArray[], int low, int high)
+{
+    for (int i = low + 1; i <= high; i++)
+    {
+        int element = dataArray[i];
+        int index = i;
+
+        while ((index > low) && (dataArray[index - 1] > element))
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The radixSort() function sorts the segment of the array between the low & high indices with in-place MSD RadixSort (American flag
+sort): it permutes the segment into 256 buckets by the digit at (shift) with cycle-leader swaps, and sorts every bucket recursively by
+the next lower digit. Segments of (cutoff) or fewer elements are sorted with insertionSort().
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int low - Index of the first element in sub-array to be sorted
+            int high - Index of the last element in sub-array to be sorted
+            int shift - Position of the lowest bit of the digit to sort by (TOP_SHIFT for the whole array)
+            int cutoff - Largest segment sorted by insertionSort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void radixSort(int dataArray[], int low, int high, int shift, int cutoff)
+{
+    int counts[RADIX]; // Number of elements per digit (one level = 256 counters on the stack)
+
+    while (true) // Skip the levels where every element has the same digit
+    {
+        if ((high - low) + 1 <= cutoff) // Small segment (or one element)
+        {
+            insertionSort(dataArray, low, high);
+            return;
+        }
+
+        for (int digit = 0; digit < RADIX; digit++)
+        {
+            counts[digit] = 0;
+        }
+        for (int i = low; i <= high; i++)
+        {
+            counts[digitOf(dataArray[i], shift)]++;
+        }
+
+        if (counts[digitOf(dataArray[low], shift)] != (high - low) + 1)
+        {
+            break; // At least two buckets -> Permute this level
+        }
+        if (shift == 0)
+        {
+            return; // Every digit is equal -> Every element is equal
+        }
+        shift -= DIGIT_BITS; // One bucket holds everything -> Nothing would move, go to the next digit
+    }
+
+    int heads[RADIX]; // First position of every bucket that does not hold one of its elements yet
+    int tails[RADIX]; // One past the last position of every bucket
+    int sum = low;
+    for (int digit = 0; digit < RADIX; digit++)
+    {
+        heads[digit] = sum;
+        sum += counts[digit];
+        tails[digit] = sum;
+    }
+
+    for (int digit = 0; digit < RADIX; digit++) // Cycle-leader permutation, bucket by bucket
+    {
+        while (heads[digit] < tails[digit])
+        {
+            int value = dataArray[heads[digit]];
+            int target = digitOf(value, shift);
+
+            while (target != digit) // Follow the cycle until an element of this bucket comes back
+            {
+                int displaced = dataArray[heads[target]];
+                dataArray[heads[target]++] = value;
+                value = displaced;
+                target = digitOf(value, shift);
+            }
+
+            dataArray[heads[digit]++] = value; // Close the cycle
+        }
+    }
+
+    if (shift == 0)
+    {
+        return; // Last digit -> Every bucket holds equal elements
+    }
+
+    for (int digit = 0; digit < RADIX; digit++) // Sort every bucket by the next digit
+    {
+        if (counts[digit] > 1)
+        {
+            int start = tails[digit] - counts[digit];
+            radixSort(dataArray, start, (tails[digit] - 1), (shift - DIGIT_BITS), cutoff);
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The radixSort() overload is the entry point for the whole array, starting at the most significant digit.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int cutoff - Largest bucket sorted by insertionSort() (values below 1 are treated as 1)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void radixSort(int dataArray[], int arraySize, int cutoff = 32)
+{
+    if (arraySize > 1)
+    {
+        radixSort(dataArray, 0, (arraySize - 1), TOP_SHIFT, (cutoff < 1) ? 1 : cutoff);
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The EngineOptions struct holds the tuning knobs of the sorting engine, which can be set on the command line as option=value.
+    >> Members:
+            int cutoff - Largest bucket sorted by insertionSort()
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct EngineOptions
+{
+    int cutoff = 32;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortWithEngine() function sorts the whole array with the named sorting engine.
+    >> Parameters:
+            const string &engine - msd (radixSort()) | std (std::sort(), the reference of the benchmark)
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            const EngineOptions &options - Tuning knobs of the engine
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortWithEngine(const string &engine, int dataArray[], int arraySize, const EngineOptions &options)
+{
+    if (engine == "msd")
+    {
+        radixSort(dataArray, arraySize, options.cutoff);
+    }
+    else if (engine == "std")
+    {
+        sort(dataArray, dataArray + arraySize);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The parseOption() function reads a single option=value command line argument into the engine options.
+    >> Parameters:
+            const string &argument - Command line argument of the form option=value
+            EngineOptions &options - Tuning knobs of the engine to be updated
+    >> Return:
+            bool - False if the option is unknown or malformed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool parseOption(const string &argument, EngineOptions &options)
+{
+    size_t separator = argument.find('=');
+
+    if (separator == string::npos)
+    {
+        return false;
+    }
+
+    string name = argument.substr(0, separator);
+    int value = atoi(argument.c_str() + separator + 1);
+
+    if (name == "cutoff")
+    {
+        options.cutoff = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The timeEngine() function sorts a copy of the input with the named sorting engine, and returns the elapsed wall-clock time.
+    >> Parameters:
+            const string &engine - Name of the sorting engine
+            const vector<int> &input - Unsorted input (left unchanged)
+            const EngineOptions &options - Tuning knobs of the engine
+            vector<int> &output - Receives the sorted copy of the input
+    >> Return:
+            double - Elapsed time in milliseconds
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+double timeEngine(const string &engine, const vector<int> &input, const EngineOptions &options, vector<int> &output)
+{
+    output = input; // Every engine sorts its own copy of the same input
+
+    auto start = chrono::steady_clock::now();
+    sortWithEngine(engine, output.data(), (int)output.size(), options);
+    auto stop = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times radixSort() against std::sort() on the same random input (generated from a fixed seed), and checks
+the radixSort() output against the std::sort() output. The input, the reference & the output are 3 copies, so 10^8 integers fit in
+memory.
+    >> Parameters:
+            int arraySize - Number of integers to sort
+            const EngineOptions &options - Tuning knobs of the engine
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark(int arraySize, const EngineOptions &options)
+{
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+    vector<int> input(arraySize);
+    for (int i = 0; i < arraySize; i++)
+    {
+        input[i] = distribution(generator);
+    }
+
+    vector<int> reference;
+    vector<int> output;
+    double stdMilliseconds = timeEngine("std", input, options, reference);
+    double msdMilliseconds = timeEngine("msd", input, options, output);
+
+    cout << endl
+         << "Benchmark: " << arraySize << " random integers (ms), cutoff=" << options.cutoff << endl
+         << "   " << left << setw(12) << "std::sort" << right << setw(12) << fixed << setprecision(2) << stdMilliseconds << endl
+         << "   " << left << setw(12) << "msd" << right << setw(12) << msdMilliseconds << endl
+         << "   " << left << setw(12) << "speedup" << right << setw(11) << (stdMilliseconds / msdMilliseconds) << "x" << endl
+         << "   Output check: " << ((output == reference) ? "OK" : "MISMATCH") << endl
+         << "   Extra memory (msd): " << (int)(3 * RADIX * sizeof(int)) << " bytes per level, at most " << (32 / DIGIT_BITS)
+         << " levels" << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() reads a data.txt file containing integers whose values have no specified limitation. The first line of the data file contains the
+# of integers to be sorted, and the following lines contain the data to be populated to the array. The array is then printed to the
+terminal before and after the RadixSort algorithm is performed.
+    >> Arguments:
+            argv[1] - Sorting engine to run: msd (default) | bench
+            argv[2] - Data file to read (default data1.txt), or the number of random integers to sort for bench (default 1000000)
+            argv[3...] - Engine options of the form option=value (cutoff=32)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "msd"; // Sorting engine selected on the command line
+    EngineOptions options;                        // Tuning knobs selected on the command line
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (!parseOption(argv[i], options))
+        {
+            cerr << "ERROR - Invalid Option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    if (engine == "bench")
+    {
+        runBenchmark((argc > 2) ? atoi(argv[2]) : 1000000, options);
+        return 0;
+    }
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    cout << endl
+         << "Running RadixSort - MSD, American Flag (" << engine << ")..." << endl;
+    // Call the selected RadixSort engine to sort the array
+    if (!sortWithEngine(engine, dataArray, arraySize, options))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    // Print the sorted array
+    cout << endl
+         << "Array after sorting:";
+    printArray(dataArray, arraySize);
+    cout << endl;
+
+    return 0;
+}
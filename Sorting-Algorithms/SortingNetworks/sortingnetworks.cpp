@@ -0,0 +1,387 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> SORTING NETWORKS <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This sortingnetworks.cpp file is a personal reference of sorting networks, the kernels used to sort the smallest arrays (2 -> 32
+elements) found at the leaves of QuickSort & MergeSort. A sorting network is a fixed sequence of compare-exchange operations
+(comparators) that sorts any input of a given size: which elements are compared never depends on the data, only the outcome of each
+comparison does. The networks themselves live in the header sortingnetworks.h, so that other sorts can include them.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Comparator (Compare-Exchange): Takes the elements at two fixed positions [i] < [j], and leaves the lesser at [i] & the greater at
+        [j]. Both are selected with a conditional expression on a single comparison, which the compiler turns into conditional moves
+        (or min/max instructions), so a comparator never branches and never suffers a branch misprediction. InsertionSort on a small
+        array mispredicts roughly once per element on random data.
+
+>> Batcher's Odd-Even Merge Sort: The networks are generated by Batcher's construction. Sorted runs of size (p) = 1, 2, 4, ... are
+        merged into runs of size (2p) by a sequence of passes at distance (k = p, p/2, ... 1), each comparing elements (k) positions
+        apart that belong to the same merge. Comparators that reach past the last element are dropped, which works for any size (not
+        only powers of two). For 4 & 8 elements the networks are optimal (5 & 19 comparators), for 16 & 32 they use 63 & 191
+        comparators, close to the best known 60 & 185.
+
+>> Compile-Time Generation: batcherNetwork<N>() is constexpr, so the compiler builds the comparator list of every size it is used with,
+        and sortN<N>() expands the list with a fold expression into one compareExchange() call per comparator, with constant indices.
+        The result is straight-line code with no loop & no branch. sortN<N>() is itself constexpr, so it also sorts at compile time:
+        sortedArray() returns a sorted copy of a std::array, and can initialize a constexpr table (see main()).
+
+>> Runtime Sizes & SIMD: sortNetwork(data, n) picks sortN<n>() for a size only known at runtime from a table of function pointers, so
+        it can be used as the leaf kernel of other sorts (MergeSort's hybrid engine uses it with leaf=network). sortSmallSimd() sorts up
+        to 8 integers inside one AVX2 register: each layer of the 8-element network (6 layers) is one lane permutation, one min, one
+        max & one blend, with unused lanes filled with INT_MAX. It falls back to sortNetwork() when the CPU has no AVX2.
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Unstable Algorithm: Sorting networks are unstable, meaning that elements with equal values are not guaranteed to retain their
+                       relative order in the sorted array (equal integers are indistinguishable, so this only matters for records).
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Time Complexity:
+        All-cases: O(n*log(n)^2) - Batcher's network has (log(n) * (log(n) + 1) / 2) layers of at most (n/2) comparators each. The same
+                                   comparators run for every input, so the best, average & worst cases are identical.
+                                      O(n) - Comparators per layer, n = # elements in array
+                                       * (for-each)
+                                      O(log(n)^2) - Layers of the network, n = # elements in array
+                                       = O(n*log(n)^2)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Space Complexity:
+        All-cases: O(1) - The network sorts in place. The comparator list is a compile-time constant, and is compiled into the code.
+                             O(1) - Temporary variables for each comparator, 1 = constant space
+                              = O(1)
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Network Diagram (4 Elements):
+        Key: ●--● = Comparator (lesser element moves up), | = Layer boundary
+        Array = {23, 1, 10, 5};
+
+            [0] 23 --●-------|--●-------|---------- 1
+                     |       |  |       |
+            [1]  1 --●-------|--|--●----|--●------- 5
+                             |  |  |    |  |
+            [2] 10 --●-------|--●--|----|--●------- 10
+                     |       |     |    |
+            [3]  5 --●-------|-----●----|---------- 23
+
+            (1) Layer 1: [0]-[1] -> {1, 23, 10, 5},  [2]-[3] -> {1, 23, 5, 10}
+            (2) Layer 2: [0]-[2] -> {1, 23, 5, 10},  [1]-[3] -> {1, 10, 5, 23}
+            (3) Layer 3: [1]-[2] -> {1, 5, 10, 23}
+
+        * SORTED: arr[] = {1, 5, 10, 23}, Total # of Comparators: 5
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> Compile & Run:
+        g++ -std=c++17 sortingnetworks.cpp || g++ -std=c++17 sortingnetworks.cpp -g -o sortingnetworks
+        ./a.out || valgrind ./a.out || valgrind ./sortingnetworks || valgrind --leak-check=full ./sortingnetworks
+        ./a.out [engine] [dataFile]
+            engine = network (default, blocks of 32) | simd (blocks of 8) | bench
+            dataFile = data1.txt (default)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#include <iostream>          // cout
+#include <fstream>           // ifstream
+#include <sstream>           // stringstream
+#include <string>            // string
+#include <vector>            // vector
+#include <random>            // mt19937, uniform_int_distribution
+#include <chrono>            // steady_clock
+#include <iomanip>           // setw, setprecision
+#include <algorithm>         // sort, is_sorted
+#include "sortingnetworks.h" // sortN, sortedArray, sortNetwork, sortSmallSimd
+
+using namespace std;
+
+// Sorted by the compiler: the network runs during compilation, and the program only contains the result
+constexpr array<int, 8> COMPILE_TIME_SORTED = sortedArray(array<int, 8>{23, 1, 10, 5, 2, 42, -7, 16});
+static_assert(COMPILE_TIME_SORTED[0] == -7 && COMPILE_TIME_SORTED[7] == 42, "sortedArray() must run at compile time");
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The insertionSort() function sorts the sub-array bounded by [left] & [right] in place. This is the InsertionSort kernel from
+InsertionSort/insertionsort.cpp, restricted to a range, used as the baseline of the benchmark.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int left - Starting index of the sub-array to be sorted
+            int right - Ending index of the sub-array to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void insertionSort(int dataArray[], int left, int right)
+{
+    for (int i = left + 1; i <= right; i++)
+    {
+        int element = dataArray[i];
+        int index = i;
+
+        while ((index > left) && (dataArray[index - 1] > element))
+        {
+            dataArray[index] = dataArray[index - 1];
+            index--;
+        }
+
+        dataArray[index] = element;
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortBlocks() function sorts every block of (blockSize) consecutive elements with the named engine (the last block may be shorter).
+    >> Parameters:
+            const string &engine - network (sortNetwork(), blocks of up to 32) | simd (sortSmallSimd(), blocks of up to 8)
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array
+            int blockSize - Number of elements per block
+    >> Return:
+            bool - False if the engine name is unknown
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+bool sortBlocks(const string &engine, int dataArray[], int arraySize, int blockSize)
+{
+    if (engine != "network" && engine != "simd")
+    {
+        return false;
+    }
+
+    for (int start = 0; start < arraySize; start += blockSize)
+    {
+        int size = (arraySize - start < blockSize) ? (arraySize - start) : blockSize;
+
+        if (engine == "network")
+        {
+            sortNetwork(dataArray + start, size);
+        }
+        else
+        {
+            sortSmallSimd(dataArray + start, size);
+        }
+    }
+
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The benchmarkSize() function sorts a random array in independent blocks of (N) elements with insertionSort(), std::sort(), sortN<N>()
+(size known at compile time), sortNetwork() (size known at runtime) & sortSmallSimd() (N <= 8), and prints the time per element.
+    >> Parameters:
+            const vector<int> &input - Random input, a multiple of (N) elements long
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int N>
+void benchmarkSize(const vector<int> &input)
+{
+    const char *kernels[] = {"insertion", "std::sort", "sortN", "sortNetwork", "simd"};
+    int blocks = (int)input.size() / N;
+    vector<int> output;
+
+    cout << "   " << left << setw(8) << N << right;
+
+    for (const char *kernel : kernels)
+    {
+        string name = kernel;
+        if (name == "simd" && N > 8)
+        {
+            cout << setw(14) << "-";
+            continue;
+        }
+
+        output = input;
+        int *data = output.data();
+
+        auto start = chrono::steady_clock::now();
+        for (int b = 0; b < blocks; b++)
+        {
+            int *block = data + (size_t)b * N;
+
+            if (name == "insertion")
+            {
+                insertionSort(block, 0, N - 1);
+            }
+            else if (name == "std::sort")
+            {
+                sort(block, block + N);
+            }
+            else if (name == "sortN")
+            {
+                sortN<N>(block);
+            }
+            else if (name == "sortNetwork")
+            {
+                sortNetwork(block, N);
+            }
+            else
+            {
+                sortSmallSimd(block, N);
+            }
+        }
+        auto stop = chrono::steady_clock::now();
+
+        bool sorted = true;
+        for (int b = 0; b < blocks; b++)
+        {
+            sorted = sorted && is_sorted(data + (size_t)b * N, data + (size_t)(b + 1) * N);
+        }
+
+        double nanoseconds = chrono::duration<double, nano>(stop - start).count() / input.size();
+        cout << setw(12) << fixed << setprecision(2) << nanoseconds << (sorted ? "  " : " !");
+    }
+    cout << endl;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The runBenchmark() function times the network kernels against InsertionSort & std::sort() on blocks of 4, 8, 16 & 32 random integers.
+A "!" after a time marks a block that was not sorted correctly.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void runBenchmark()
+{
+    const int totalElements = 1 << 20; // A multiple of every block size
+
+    mt19937 generator(12345);
+    uniform_int_distribution<int> distribution(-1000000, 1000000);
+    vector<int> input(totalElements);
+    for (int &element : input)
+    {
+        element = distribution(generator);
+    }
+
+    cout << endl
+         << "Benchmark: " << totalElements << " random integers in blocks (ns per element)" << endl
+         << "   " << left << setw(8) << "block" << right << setw(14) << "insertion" << setw(14) << "std::sort" << setw(14) << "sortN"
+         << setw(14) << "sortNetwork" << setw(14) << "simd" << endl;
+
+    benchmarkSize<4>(input);
+    benchmarkSize<8>(input);
+    benchmarkSize<16>(input);
+    benchmarkSize<32>(input);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The printArray() function traverses the given array and prints the contents out to the terminal. Prints the output in a reader friendly
+format.
+    >> Parameters:
+            int dataArray[] - Pointer to array of integers
+            int arraySize - Size of the array to be printed
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+void printArray(int dataArray[], int arraySize)
+{
+    for (int i = 0; i < arraySize; i++)
+    {
+        if ((i % 25) == 0) // New line every 25 elements printed
+        {
+            cout << endl
+                 << "   "; // Indent each new line
+        }
+        if (i == (arraySize - 1)) // Last element
+        {
+            if (dataArray[i] < 10) // If single-digit & last
+            {
+                cout << " " << dataArray[i] << endl; // Add extra space
+            }
+            else // Otherwise just print the element
+            {
+                cout << dataArray[i] << endl;
+            }
+        }
+        else // Element is not last
+        {
+            if (dataArray[i] < 10) // If single-digit & not last
+            {
+                cout << " " << dataArray[i] << ", "; // Pad element with space " " & trailing comma
+            }
+            else // Otherwise just add a trailing comma
+            {
+                cout << dataArray[i] << ", ";
+            }
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+main() prints the std::array sorted at compile time, then reads a data.txt file containing integers whose values have no specified
+limitation. The first line of the data file contains the # of integers to be sorted, and the following lines contain the data to be
+populated to the array. The array is then printed to the terminal before and after every block of it is sorted by a network.
+    >> Arguments:
+            argv[1] - Engine to run: network (default, blocks of 32) | simd (blocks of 8) | bench
+            argv[2] - Data file to read (default data1.txt)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+int main(int argc, char *argv[])
+{
+    string engine = (argc > 1) ? argv[1] : "network"; // Engine selected on the command line
+
+    if (engine == "bench")
+    {
+        runBenchmark();
+        return 0;
+    }
+
+    cout << endl
+         << "Sorted at compile time (sortedArray()):";
+    int compileTime[8];
+    copy(COMPILE_TIME_SORTED.begin(), COMPILE_TIME_SORTED.end(), compileTime);
+    printArray(compileTime, 8);
+
+    // Read the data from file
+    ifstream infile((argc > 2) ? argv[2] : "data1.txt");
+
+    if (!infile)
+    {
+        cerr << "ERROR - File Not Found" << endl;
+        return 1;
+    }
+
+    int arraySize = 0;        // Number of integers to be sorted (Size of array)
+    infile >> arraySize;      // Size is first line of data file
+    int dataArray[arraySize]; // To hold our data to be sorted
+
+    if (arraySize <= 0) // Check valid # of integers
+    {
+        cerr << "ERROR - Invalid Number Of Integers" << endl;
+        return 1;
+    }
+
+    int index = 0; // Index to insert element into dataArray
+    string line;
+
+    while (getline(infile, line)) // Get the next line of data after arraySize
+    {
+        if (line == "")
+        {
+            continue; // Skip empty lines
+        }
+
+        stringstream ss(line); // To parse each line
+        int element;           // To store each integer delimited by a space " "
+
+        // While there is a next integer and there are more integers's to store
+        while ((ss >> element) && (index < arraySize))
+        {
+            dataArray[index++] = element; // Store the integer @ index, then increment the index
+        }
+    }
+
+    // Print unsorted array
+    cout << endl
+         << "Array before sorting:";
+    printArray(dataArray, arraySize);
+
+    int blockSize = (engine == "simd") ? 8 : MAX_NETWORK_SIZE;
+    cout << endl
+         << "Running Sorting Networks (" << engine << ", blocks of " << blockSize << ")..." << endl;
+    // Sort every block of the array with the selected network kernel
+    if (!sortBlocks(engine, dataArray, arraySize, blockSize))
+    {
+        cerr << "ERROR - Unknown Engine: " << engine << endl;
+        return 1;
+    }
+
+    // Print the array with every block sorted
+    cout << endl
+         << "Array after sorting every block:";
+    printArray(dataArray, arraySize);
+    cout << endl;
+
+    return 0;
+}
@@ -0,0 +1,310 @@
+/*
+Author: Henryk Musial
+10/17/2026
+*/
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+>> SORTINGNETWORKS.H - COMPILE-TIME SORTING NETWORKS (N <= 32) <<
+-----------------------------------------------------------------------------------------------------------------------------------------
+This header generates Batcher odd-even merge sorting networks for fixed sizes at compile time, and expands them into straight-line code
+of branchless compare-exchanges. It is header-only, so that other sorts can include it & use sortNetwork() as their leaf kernel. See
+sortingnetworks.cpp for the description of the algorithm, the demo & the benchmark.
+    >> Templates & Functions:
+            sortN<N>(T data[]) - Sorts (N) elements in place, usable in constexpr functions
+            sortedArray(std::array<T, N>) - Returns a sorted copy of a std::array, usable at compile time
+            sortNetwork(int data[], int n) - Sorts (n <= 32) integers with the network for (n), picked from a table at runtime
+            sortSmallSimd(int data[], int n) - Sorts (n <= 8) integers inside one AVX2 register when the CPU supports it
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+
+#ifndef SORTINGNETWORKS_H
+#define SORTINGNETWORKS_H
+
+#include <array>   // array
+#include <cstddef> // size_t
+#include <utility> // index_sequence, make_index_sequence
+#include <climits> // INT_MAX
+
+const int MAX_NETWORK_SIZE = 32; // Largest size with a generated network
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The Comparator struct is one compare-exchange of a sorting network: after it, [first] holds the lesser & [second] the greater of the
+two elements (first < second).
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct Comparator
+{
+    int first;
+    int second;
+};
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The batcherComparators() function visits the comparators of Batcher's odd-even merge sort for (n) elements in network order. Merges of
+size (2p) are built from passes at distance (k = p, p/2, ... 1), and the comparators of one pass touch disjoint elements, so every
+pass is one layer of the network. Comparators that would reach past (n) are left out, which is the same as padding the input to a power
+of two with elements greater than all others.
+    >> Parameters:
+            int n - Number of elements sorted by the network
+            Visit visit - Called as visit(pass, first, second) for every comparator
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename Visit>
+constexpr void batcherComparators(int n, Visit visit)
+{
+    int pass = 0;
+
+    for (int p = 1; p < n; p += p) // Merge sorted runs of size p into runs of size 2p
+    {
+        for (int k = p; k > 0; k /= 2) // Compare-exchange at distance k
+        {
+            for (int j = k % p; j + k < n; j += k + k)
+            {
+                for (int i = 0; i < k && i + j + k < n; i++)
+                {
+                    if ((i + j) / (p + p) == (i + j + k) / (p + p)) // Both elements belong to the same merge
+                    {
+                        visit(pass, i + j, i + j + k);
+                    }
+                }
+            }
+            pass++;
+        }
+    }
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The comparatorCount() function counts the comparators of the network for (n) elements (5 for n = 4, 19 for n = 8, 63 for n = 16,
+191 for n = 32 - the best known networks need 5, 19, 60 & 185).
+    >> Parameters:
+            int n - Number of elements sorted by the network
+    >> Return:
+            int - Number of comparators
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+constexpr int comparatorCount(int n)
+{
+    int count = 0;
+    batcherComparators(n, [&count](int, int, int) { count++; });
+    return count;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The batcherNetwork() function builds the list of comparators of the network for (N) elements at compile time.
+    >> Return:
+            std::array<Comparator, comparatorCount(N)> - The comparators in network order
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int N>
+constexpr std::array<Comparator, comparatorCount(N)> batcherNetwork()
+{
+    std::array<Comparator, comparatorCount(N)> network{};
+    int index = 0;
+    batcherComparators(N, [&network, &index](int, int first, int second) { network[index++] = Comparator{first, second}; });
+    return network;
+}
+
+template <int N>
+constexpr std::array<Comparator, comparatorCount(N)> NETWORK = batcherNetwork<N>(); // One table per size, built by the compiler
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The compareExchange() function puts the lesser of two elements in (a) & the greater in (b). Both are computed with a conditional
+expression on the same comparison, which compiles to conditional moves (or min/max instructions), not a branch.
+    >> Parameters:
+            T &a - Element at the lower position of the comparator
+            T &b - Element at the higher position of the comparator
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T>
+constexpr void compareExchange(T &a, T &b)
+{
+    bool swapped = (b < a);
+    T lesser = swapped ? b : a;
+    T greater = swapped ? a : b;
+    a = lesser;
+    b = greater;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The applyNetwork() function expands every comparator of the network for (N) elements into its own compareExchange() call with constant
+indices (a fold expression over the comparator numbers), so the sort is straight-line code with no loop & no data-dependent branch.
+    >> Parameters:
+            T data[] - Pointer to the (N) elements to be sorted
+            std::index_sequence<I...> - Comparator numbers 0 -> comparatorCount(N) - 1
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int N, typename T, std::size_t... I>
+constexpr void applyNetwork(T data[], std::index_sequence<I...>)
+{
+    static_cast<void>(data); // Unused when the network has no comparators (N < 2)
+    (compareExchange(data[NETWORK<N>[I].first], data[NETWORK<N>[I].second]), ...);
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortN() function sorts (N) elements in place with the compile-time network for (N). Any type with operator< can be sorted, and
+the function is constexpr, so it can also run at compile time.
+    >> Parameters:
+            T data[] - Pointer to the (N) elements to be sorted
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <int N, typename T>
+constexpr void sortN(T data[])
+{
+    static_assert(N >= 0 && N <= MAX_NETWORK_SIZE, "sortN() supports 0 -> 32 elements");
+    applyNetwork<N>(data, std::make_index_sequence<NETWORK<N>.size()>());
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortedArray() function returns a sorted copy of a std::array, e.g. constexpr auto table = sortedArray(std::array<int, 4>{...}).
+    >> Parameters:
+            std::array<T, N> values - Array to be sorted (by value)
+    >> Return:
+            std::array<T, N> - The sorted array
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+template <typename T, std::size_t N>
+constexpr std::array<T, N> sortedArray(std::array<T, N> values)
+{
+    sortN<(int)N>(values.data());
+    return values;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The NetworkKernel type is sortN<N>() for integers with (N) fixed, and makeNetworkTable() lists sortN<0>() -> sortN<32>(), so that a
+size known only at runtime can be sorted by its own network.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+typedef void (*NetworkKernel)(int data[]);
+
+template <std::size_t... N>
+constexpr std::array<NetworkKernel, sizeof...(N)> makeNetworkTable(std::index_sequence<N...>)
+{
+    return {{&sortN<(int)N, int>...}};
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortNetwork() function sorts (n) integers with the network for (n), the leaf kernel used by other sorts.
+    >> Parameters:
+            int data[] - Pointer to the integers to be sorted
+            int n - Number of integers
+    >> Return:
+            bool - False (nothing sorted) if (n) is larger than MAX_NETWORK_SIZE
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+inline bool sortNetwork(int data[], int n)
+{
+    static constexpr std::array<NetworkKernel, MAX_NETWORK_SIZE + 1> table =
+        makeNetworkTable(std::make_index_sequence<MAX_NETWORK_SIZE + 1>());
+
+    if (n < 0 || n > MAX_NETWORK_SIZE)
+    {
+        return false;
+    }
+
+    table[n](data);
+    return true;
+}
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The NetworkLayer struct is one layer of the 8-element network in the form used by sortSmallAvx2(): lane [i] is compared with lane
+partner[i] (itself if the layer has no comparator for it), and keeps the greater element if takeGreater[i] is -1 (all bits set).
+networkLayers8() builds the layers from NETWORK<8> at compile time.
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+struct NetworkLayer
+{
+    int partner[8];
+    int takeGreater[8];
+};
+
+const int NETWORK_LAYERS_8 = 6; // Batcher's network for 8 elements is 6 layers deep
+
+constexpr std::array<NetworkLayer, NETWORK_LAYERS_8> networkLayers8()
+{
+    std::array<NetworkLayer, NETWORK_LAYERS_8> layers{};
+    for (int layer = 0; layer < NETWORK_LAYERS_8; layer++)
+    {
+        for (int lane = 0; lane < 8; lane++)
+        {
+            layers[layer].partner[lane] = lane;
+        }
+    }
+
+    batcherComparators(8, [&layers](int pass, int first, int second) {
+        layers[pass].partner[first] = second;
+        layers[pass].partner[second] = first;
+        layers[pass].takeGreater[second] = -1;
+    });
+
+    return layers;
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_NETWORK_KERNELS 1
+#include <immintrin.h> // AVX2 intrinsics (compiled per function with a target attribute, no -mavx2 flag needed)
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortSmallAvx2() function sorts up to 8 integers without leaving a register: the integers are loaded into the lanes of one AVX2
+register (unused lanes are filled with INT_MAX, so they sort to the end), every layer of the network is one lane permutation, one min,
+one max & one blend, and the first (n) lanes are stored back.
+    >> Parameters:
+            int data[] - Pointer to the integers to be sorted
+            int n - Number of integers (0 -> 8)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+__attribute__((target("avx2"))) inline void sortSmallAvx2(int data[], int n)
+{
+    static constexpr std::array<NetworkLayer, NETWORK_LAYERS_8> layers = networkLayers8();
+
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i used = _mm256_cmpgt_epi32(_mm256_set1_epi32(n), lanes); // -1 in the first (n) lanes
+    __m256i values = _mm256_maskload_epi32(data, used);
+    values = _mm256_blendv_epi8(_mm256_set1_epi32(INT_MAX), values, used);
+
+    for (int layer = 0; layer < NETWORK_LAYERS_8; layer++)
+    {
+        __m256i partner = _mm256_loadu_si256((const __m256i *)layers[layer].partner);
+        __m256i takeGreater = _mm256_loadu_si256((const __m256i *)layers[layer].takeGreater);
+
+        __m256i other = _mm256_permutevar8x32_epi32(values, partner);
+        values = _mm256_blendv_epi8(_mm256_min_epi32(values, other), _mm256_max_epi32(values, other), takeGreater);
+    }
+
+    _mm256_maskstore_epi32(data, used, values);
+}
+#endif
+
+/*
+-----------------------------------------------------------------------------------------------------------------------------------------
+The sortSmallSimd() function sorts up to 8 integers with sortSmallAvx2() when the CPU supports AVX2, and with sortNetwork() otherwise.
+    >> Parameters:
+            int data[] - Pointer to the integers to be sorted
+            int n - Number of integers (0 -> 8)
+-----------------------------------------------------------------------------------------------------------------------------------------
+*/
+inline void sortSmallSimd(int data[], int n)
+{
+#ifdef HAVE_X86_NETWORK_KERNELS
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    if (hasAvx2)
+    {
+        sortSmallAvx2(data, n);
+        return;
+    }
+#endif
+    sortNetwork(data, n);
+}
+
+#endif